@@ -33,27 +33,183 @@
 #define WR_HIGH     (CORE_PIN30_PORTSET=CORE_PIN30_BITMASK)
 #define WR_LOW      (CORE_PIN30_PORTCLEAR=CORE_PIN30_BITMASK)
 #define RD_HIGH     (CORE_PIN29_PORTSET=CORE_PIN29_BITMASK)
+#define RD_LOW      (CORE_PIN29_PORTCLEAR=CORE_PIN29_BITMASK)
 #define RESET_HIGH  (CORE_PIN28_PORTSET=CORE_PIN28_BITMASK)
 #define RESET_LOW   (CORE_PIN28_PORTCLEAR=CORE_PIN28_BITMASK)
 
+// データピンはそのままで WR のみ１パルス出す(直前と同じバイトを再送する)
+#define WR_STROBE   { WR_LOW; WR_LOW; WR_LOW; WR_HIGH; WR_HIGH; WR_HIGH; }
+
+// -----------------------------------------------------------------------------
+//  データバス出力用マスクテーブル
+//  D0～D7 は次の3つの GPIO ポートに分かれて接続されている
+//      D0    : pin33       (GPIO9)
+//      D1～D4 : pin34～37  (GPIO7)
+//      D5～D7 : pin38～40  (GPIO6)
+//  バイト値ごとに各ポートのセット/クリアマスクをコンパイル時に求めておき、
+//  write8() では分岐なしで常に6回のレジスタ書き込みで済ませる
+// -----------------------------------------------------------------------------
+struct BusMask
+{
+    uint32_t set0, clr0;    // GPIO9 (D0)
+    uint32_t set1, clr1;    // GPIO7 (D1～D4)
+    uint32_t set2, clr2;    // GPIO6 (D5～D7)
+};
+
+#define BUS_PORT0       (CORE_PIN33_BITMASK)
+#define BUS_PORT1       (CORE_PIN34_BITMASK|CORE_PIN35_BITMASK|CORE_PIN36_BITMASK|CORE_PIN37_BITMASK)
+#define BUS_PORT2       (CORE_PIN38_BITMASK|CORE_PIN39_BITMASK|CORE_PIN40_BITMASK)
+#define BUS_BIT(c, n, pin)  (((c) & (1<<(n)))? CORE_PIN##pin##_BITMASK : 0)
+#define BUS_SET0(c)     (BUS_BIT(c, 0, 33))
+#define BUS_SET1(c)     (BUS_BIT(c, 1, 34)|BUS_BIT(c, 2, 35)|BUS_BIT(c, 3, 36)|BUS_BIT(c, 4, 37))
+#define BUS_SET2(c)     (BUS_BIT(c, 5, 38)|BUS_BIT(c, 6, 39)|BUS_BIT(c, 7, 40))
+#define BUS_ENTRY(c)    { BUS_SET0(c), BUS_PORT0 ^ BUS_SET0(c), \
+                          BUS_SET1(c), BUS_PORT1 ^ BUS_SET1(c), \
+                          BUS_SET2(c), BUS_PORT2 ^ BUS_SET2(c) }
+#define BUS_ROW(c)      BUS_ENTRY((c)+0x0), BUS_ENTRY((c)+0x1), BUS_ENTRY((c)+0x2), BUS_ENTRY((c)+0x3), \
+                        BUS_ENTRY((c)+0x4), BUS_ENTRY((c)+0x5), BUS_ENTRY((c)+0x6), BUS_ENTRY((c)+0x7), \
+                        BUS_ENTRY((c)+0x8), BUS_ENTRY((c)+0x9), BUS_ENTRY((c)+0xA), BUS_ENTRY((c)+0xB), \
+                        BUS_ENTRY((c)+0xC), BUS_ENTRY((c)+0xD), BUS_ENTRY((c)+0xE), BUS_ENTRY((c)+0xF)
+
+static const BusMask s_busMask[256] = {
+    BUS_ROW(0x00), BUS_ROW(0x10), BUS_ROW(0x20), BUS_ROW(0x30),
+    BUS_ROW(0x40), BUS_ROW(0x50), BUS_ROW(0x60), BUS_ROW(0x70),
+    BUS_ROW(0x80), BUS_ROW(0x90), BUS_ROW(0xA0), BUS_ROW(0xB0),
+    BUS_ROW(0xC0), BUS_ROW(0xD0), BUS_ROW(0xE0), BUS_ROW(0xF0)
+};
+
 // -----------------------------------------------------------------------------
 void HX8357::write8(uint8_t c)
 {
+    const BusMask *m = &s_busMask[c];
     WR_LOW;
-    if( c & 0x01 ){ CORE_PIN33_PORTSET = CORE_PIN33_BITMASK; } else { CORE_PIN33_PORTCLEAR = CORE_PIN33_BITMASK; }
-    if( c & 0x02 ){ CORE_PIN34_PORTSET = CORE_PIN34_BITMASK; } else { CORE_PIN34_PORTCLEAR = CORE_PIN34_BITMASK; }
-    if( c & 0x04 ){ CORE_PIN35_PORTSET = CORE_PIN35_BITMASK; } else { CORE_PIN35_PORTCLEAR = CORE_PIN35_BITMASK; }
-    if( c & 0x08 ){ CORE_PIN36_PORTSET = CORE_PIN36_BITMASK; } else { CORE_PIN36_PORTCLEAR = CORE_PIN36_BITMASK; }
-    if( c & 0x10 ){ CORE_PIN37_PORTSET = CORE_PIN37_BITMASK; } else { CORE_PIN37_PORTCLEAR = CORE_PIN37_BITMASK; }
-    if( c & 0x20 ){ CORE_PIN38_PORTSET = CORE_PIN38_BITMASK; } else { CORE_PIN38_PORTCLEAR = CORE_PIN38_BITMASK; }
-    if( c & 0x40 ){ CORE_PIN39_PORTSET = CORE_PIN39_BITMASK; } else { CORE_PIN39_PORTCLEAR = CORE_PIN39_BITMASK; }
-    if( c & 0x80 ){ CORE_PIN40_PORTSET = CORE_PIN40_BITMASK; } else { CORE_PIN40_PORTCLEAR = CORE_PIN40_BITMASK; }
+    CORE_PIN33_PORTSET   = m->set0;
+    CORE_PIN33_PORTCLEAR = m->clr0;
+    CORE_PIN34_PORTSET   = m->set1;
+    CORE_PIN34_PORTCLEAR = m->clr1;
+    CORE_PIN38_PORTSET   = m->set2;
+    CORE_PIN38_PORTCLEAR = m->clr2;
     WR_HIGH;
+    m_busValue = c;
+#ifdef HX8357_STATS
+    m_stats.busBytes++;
+    m_stats.portWrites += 6;
+#endif
+#ifdef HX8357_MIRROR
+    m_mirror.write(c);
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//  データバスから１バイト読み込む(データピンを入力にしておくこと)
+//  フレームメモリの読み出しは RD の LOW 期間 150ns 以上、HIGH 期間 250ns 以上、
+//  RD の立ち下がりからデータ確定まで最大 340ns
+// -----------------------------------------------------------------------------
+#define BUS_GET(v, n, pin)  (((v) & CORE_PIN##pin##_BITMASK)? (1<<(n)) : 0)
+
+uint8_t HX8357::read8()
+{
+#ifdef HX8357_MIRROR
+    // パネルがなくても読み出しを確かめられるよう、写しの GRAM から答える
+    // (RD のパルスだけはパネルに出しておく)
+    RD_LOW;
+    delayNanoseconds(340);
+    RD_HIGH;
+    delayNanoseconds(250);
+    return m_mirror.read();
+#else
+    RD_LOW;
+    delayNanoseconds(340);
+    uint32_t p0 = CORE_PIN33_PINREG;
+    uint32_t p1 = CORE_PIN34_PINREG;
+    uint32_t p2 = CORE_PIN38_PINREG;
+    RD_HIGH;
+    delayNanoseconds(250);
+    return (uint8_t)(BUS_GET(p0, 0, 33) |
+                     BUS_GET(p1, 1, 34) | BUS_GET(p1, 2, 35) | BUS_GET(p1, 3, 36) | BUS_GET(p1, 4, 37) |
+                     BUS_GET(p2, 5, 38) | BUS_GET(p2, 6, 39) | BUS_GET(p2, 7, 40));
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//  データピン(D0～D7)の入出力を切り替える
+// -----------------------------------------------------------------------------
+void HX8357::setBusDirection(uint8_t mode)
+{
+    for( int i = 33 ; i <= 40 ; i++ )
+    {
+        pinMode(i, mode);
+    }
+    m_busValue = 0xFFFF;
+}
+
+// -----------------------------------------------------------------------------
+//  データバスに出ている値と同じならデータピンは更新せずストローブのみ出す
+// -----------------------------------------------------------------------------
+inline void HX8357::writeData8(uint8_t c)
+{
+    if( c == m_busValue )
+    {
+        WR_STROBE;
+#ifdef HX8357_STATS
+        m_stats.busBytes++;
+        m_stats.strobeOnly++;
+#endif
+#ifdef HX8357_MIRROR
+        m_mirror.write(c);
+#endif
+        return;
+    }
+    write8(c);
+}
+
+// -----------------------------------------------------------------------------
+//  コマンドを送出し、続くデータ転送のために C/D を DATA に戻す
+// -----------------------------------------------------------------------------
+void HX8357::writeCommand(uint8_t c)
+{
+    wait();
+    CD_COMMAND;
+#ifdef HX8357_MIRROR
+    m_mirror.beginCommand();
+#endif
+    write8(c);
+    CD_DATA;
+#ifdef HX8357_STATS
+    m_stats.commands++;
+#endif
 }
 
 // -----------------------------------------------------------------------------
-HX8357::HX8357() : m_width(HX8357_TFTWIDTH), m_height(HX8357_TFTHEIGHT)
+uint16_t HX8357::m_busValue = 0xFFFF;  // 不定(どのバイト値とも一致しない)
+
+#ifdef HX8357_MIRROR
+HX8357Mirror HX8357::m_mirror;
+#endif
+
+#ifdef HX8357_STATS
+HX8357Stats HX8357::m_stats = {0, 0, 0, 0, 0};
+
+void HX8357::resetStats()
+{
+    memset(&m_stats, 0, sizeof(m_stats));
+}
+
+void HX8357::printStats(const char *label)
 {
+    Serial.printf("[%s] commands=%lu bytes=%lu port writes=%lu strobe only=%lu window saved=%lu\n", label,
+        (unsigned long)m_stats.commands, (unsigned long)m_stats.busBytes,
+        (unsigned long)m_stats.portWrites, (unsigned long)m_stats.strobeOnly,
+        (unsigned long)m_stats.windowBytesSaved);
+}
+#endif
+
+// -----------------------------------------------------------------------------
+HX8357::HX8357() : m_width(HX8357_TFTWIDTH), m_height(HX8357_TFTHEIGHT),
+    m_stagingIndex(0)
+{
+    this->invalidateAddrWindow();
+    this->setClipRect();
 }
 
 // -----------------------------------------------------------------------------
@@ -63,7 +219,15 @@ void HX8357::begin(void)
     {
         pinMode(i, OUTPUT);
     }
+#ifdef HX8357_MIRROR
+    m_mirror.begin();
+#endif
     this->init();
+#ifdef HX8357_TE_PIN
+    pinMode(HX8357_TE_PIN, INPUT);
+    attachInterrupt(HX8357_TE_PIN, HX8357::onTearing, RISING);
+#endif
+    m_frameTime = micros();
 }
 
 // -----------------------------------------------------------------------------
@@ -146,6 +310,7 @@ static const uint8_t HX8357D_regValues[] PROGMEM = {
 void HX8357::init() 
 {
     reset();
+    invalidateAddrWindow();
 
     delay(200);
 
@@ -163,9 +328,7 @@ void HX8357::init()
         } 
         else 
         {
-            CD_COMMAND;
-            write8(r);
-            CD_DATA;
+            writeCommand(r);
             for (uint8_t d = 0; d < len; d++) 
             {
                 uint8_t x = HX8357D_regValues[i++];
@@ -189,6 +352,9 @@ void HX8357::reset(void)
     // Data transfer sync
     CS_LOW;
     CD_COMMAND;
+#ifdef HX8357_MIRROR
+    m_mirror.beginCommand();
+#endif
     write8(0x00);
     for (uint8_t i = 0; i < 3; i++)
     {
@@ -196,24 +362,56 @@ void HX8357::reset(void)
     }
 }
 
+// -----------------------------------------------------------------------------
+//  アドレスウィンドウを設定する
+//  前回設定した列(CASET)・ページ(PASET)範囲と同じならそのコマンドは送らない
+//  (RAMWR で書き込み位置はウィンドウの先頭に戻るので、範囲が同じなら再送は不要)
 // -----------------------------------------------------------------------------
 void HX8357::setAddrWindow(int16_t x1, int16_t y1, int16_t x2, int16_t y2) 
 {
-    CD_COMMAND;
-    write8(HX8357_CASET);
-    CD_DATA;
-    write8((uint8_t)(x1 >> 8));
-    write8((uint8_t)(x1 & 0xFF));
-    write8((uint8_t)(x2 >> 8));
-    write8((uint8_t)(x2 & 0xFF));
+    if( (x1 != this->m_windowX1) || (x2 != this->m_windowX2) )
+    {
+        writeCommand(HX8357_CASET);
+        write8((uint8_t)(x1 >> 8));
+        write8((uint8_t)(x1 & 0xFF));
+        write8((uint8_t)(x2 >> 8));
+        write8((uint8_t)(x2 & 0xFF));
+        this->m_windowX1 = x1;
+        this->m_windowX2 = x2;
+    }
+#ifdef HX8357_STATS
+    else
+    {
+        m_stats.windowBytesSaved += 5;
+    }
+#endif
 
-    CD_COMMAND;
-    write8(HX8357_PASET);
-    CD_DATA;
-    write8((uint8_t)(y1 >> 8));
-    write8((uint8_t)(y1 & 0xFF));
-    write8((uint8_t)(y2 >> 8));
-    write8((uint8_t)(y2 & 0xFF));
+    if( (y1 != this->m_windowY1) || (y2 != this->m_windowY2) )
+    {
+        writeCommand(HX8357_PASET);
+        write8((uint8_t)(y1 >> 8));
+        write8((uint8_t)(y1 & 0xFF));
+        write8((uint8_t)(y2 >> 8));
+        write8((uint8_t)(y2 & 0xFF));
+        this->m_windowY1 = y1;
+        this->m_windowY2 = y2;
+    }
+#ifdef HX8357_STATS
+    else
+    {
+        m_stats.windowBytesSaved += 5;
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//  アドレスウィンドウのキャッシュを無効にする(次回の setAddrWindow で必ず送出する)
+//  リセット後や MADCTL の変更後など、コントローラ側の値が不明になった時に呼ぶ
+// -----------------------------------------------------------------------------
+void HX8357::invalidateAddrWindow()
+{
+    this->m_windowX1 = this->m_windowX2 = -1;
+    this->m_windowY1 = this->m_windowY2 = -1;
 }
 
 // -----------------------------------------------------------------------------
@@ -221,13 +419,19 @@ void HX8357::setAddrWindow(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
 // Requires setAddrWindow() has previously been called to set the fill
 // bounds.  'len' is inclusive, MUST be >= 1.
 void HX8357::flood(uint16_t color, uint32_t len) 
+{
+    writeCommand(HX8357_RAMWR);
+    startTransfer(nullptr, color, len);
+}
+
+// -----------------------------------------------------------------------------
+//  同じ色を len ピクセル分送出する(RAMWR 送出済みであること)
+// -----------------------------------------------------------------------------
+void HX8357::writeColor(uint16_t color, uint32_t len)
 {
     uint8_t hi = (uint8_t)(color >> 8);
     uint8_t lo = (uint8_t)(color & 0xFF);
 
-    CD_COMMAND;
-    write8(HX8357_RAMWR);
-    CD_DATA;
     write8(hi);
     write8(lo);
     len--;
@@ -261,6 +465,13 @@ void HX8357::flood(uint16_t color, uint32_t len)
             WR_LOW; WR_LOW; WR_LOW; WR_HIGH; WR_HIGH; WR_HIGH;
             WR_LOW; WR_LOW; WR_LOW; WR_HIGH; WR_HIGH; WR_HIGH;
         }
+#ifdef HX8357_STATS
+        m_stats.busBytes += 2*len;  // ストローブのみで送出したバイト
+        m_stats.strobeOnly += 2*len;
+#endif
+#ifdef HX8357_MIRROR
+        m_mirror.repeat(hi, 2*len);
+#endif
     } 
     else 
     {
@@ -289,109 +500,83 @@ void HX8357::flood(uint16_t color, uint32_t len)
 }
 
 // -----------------------------------------------------------------------------
-void HX8357::drawFastHLine(int16_t x, int16_t y, int16_t length, uint16_t color) 
+//  クリップ範囲を設定する(画面の外は常に除く)
+//  以降の描画はすべてこの範囲の中だけに行う
+// -----------------------------------------------------------------------------
+void HX8357::setClipRect(int16_t x, int16_t y, int16_t w, int16_t h)
 {
-    int16_t x2;
+    // 右端・下端は int16_t に収まらないことがあるので、画面で切り詰めてから戻す
+    int32_t x2 = (int32_t)x + w - 1;
+    int32_t y2 = (int32_t)y + h - 1;
+    this->m_clipX1 = max(x, (int16_t)0);
+    this->m_clipY1 = max(y, (int16_t)0);
+    this->m_clipX2 = (int16_t)min(x2, (int32_t)(this->m_width - 1));
+    this->m_clipY2 = (int16_t)min(y2, (int32_t)(this->m_height - 1));
+}
 
-    // Initial off-screen clipping
-    if ((length <= 0) || (y < 0) || (y >= m_height) || (x >= m_width) ||
-        ((x2 = (x + length - 1)) < 0))
-        return;
+// -----------------------------------------------------------------------------
+//  クリップ範囲を画面全体に戻す
+// -----------------------------------------------------------------------------
+void HX8357::setClipRect()
+{
+    this->setClipRect(0, 0, this->m_width, this->m_height);
+}
 
-    if (x < 0) { // Clip left
-        length += x;
-        x = 0;
-    }
-    if (x2 >= m_width) { // Clip right
-        x2 = m_width - 1;
-        length = x2 - x + 1;
+// -----------------------------------------------------------------------------
+//  矩形をクリップ範囲で切り詰める(何も残らなければ false)
+// -----------------------------------------------------------------------------
+bool HX8357::clip(int16_t *x, int16_t *y, int16_t *w, int16_t *h)
+{
+    int16_t x1 = max(*x, this->m_clipX1);
+    int16_t y1 = max(*y, this->m_clipY1);
+    int16_t x2 = min((int16_t)(*x + *w - 1), this->m_clipX2);
+    int16_t y2 = min((int16_t)(*y + *h - 1), this->m_clipY2);
+    if( (*w <= 0) || (*h <= 0) || (x1 > x2) || (y1 > y2) )
+    {
+        return false;
     }
+    *x = x1;
+    *y = y1;
+    *w = x2 - x1 + 1;
+    *h = y2 - y1 + 1;
+    return true;
+}
 
-    setAddrWindow(x, y, x2, y);
-    flood(color, length);
+// -----------------------------------------------------------------------------
+void HX8357::drawFastHLine(int16_t x, int16_t y, int16_t length, uint16_t color) 
+{
+    this->fillRect(x, y, length, 1, color);
 }
 
 // -----------------------------------------------------------------------------
 void HX8357::drawFastVLine(int16_t x, int16_t y, int16_t length, uint16_t color) 
 {
-    int16_t y2;
-
-    // Initial off-screen clipping
-    if ((length <= 0) || (x < 0) || (x >= m_width) || (y >= m_height) ||
-        ((y2 = (y + length - 1)) < 0))
-        return;
-    if (y < 0) { // Clip top
-        length += y;
-        y = 0;
-    }
-    if (y2 >= m_height) { // Clip bottom
-        y2 = m_height - 1;
-        length = y2 - y + 1;
-    }
-
-    setAddrWindow(x, y, x, y2);
-    flood(color, length);
+    this->fillRect(x, y, 1, length, color);
 }
 
+// -----------------------------------------------------------------------------
+//  辺ごとにクリップする(矩形ごと切り詰めるとクリップ範囲の境界に辺が描かれるため)
 // -----------------------------------------------------------------------------
 void HX8357::drawRect(int16_t x1, int16_t y1, int16_t w, int16_t h, uint16_t color)
 {
-    int16_t x2, y2;
-
-    // Initial off-screen clipping
-    if ((w <= 0) || (h <= 0) || (x1 >= m_width) || (y1 >= m_height) ||
-        ((x2 = x1 + w - 1) < 0) || ((y2 = y1 + h - 1) < 0))
+    if( (w <= 0) || (h <= 0) )
+    {
         return;
-    if (x1 < 0) { // Clip left
-        w += x1;
-        x1 = 0;
-    }
-    if (y1 < 0) { // Clip top
-        h += y1;
-        y1 = 0;
     }
-    if (x2 >= m_width) { // Clip right
-        x2 = m_width - 1;
-        w = x2 - x1 + 1;
-    }
-    if (y2 >= m_height) { // Clip bottom
-        y2 = m_height - 1;
-        h = y2 - y1 + 1;
-    }
-
     drawFastHLine(x1, y1, w, color);
-    drawFastHLine(x1, y2, w, color);
+    drawFastHLine(x1, y1 + h - 1, w, color);
     drawFastVLine(x1, y1, h, color);
-    drawFastVLine(x2, y1, h, color);
+    drawFastVLine(x1 + w - 1, y1, h, color);
 }
 
 // -----------------------------------------------------------------------------
 void HX8357::fillRect(int16_t x1, int16_t y1, int16_t w, int16_t h, uint16_t fillcolor) 
 {
-    int16_t x2, y2;
-
-    // Initial off-screen clipping
-    if ((w <= 0) || (h <= 0) || (x1 >= m_width) || (y1 >= m_height) ||
-        ((x2 = x1 + w - 1) < 0) || ((y2 = y1 + h - 1) < 0))
+    if( !this->clip(&x1, &y1, &w, &h) )
+    {
         return;
-    if (x1 < 0) { // Clip left
-        w += x1;
-        x1 = 0;
     }
-    if (y1 < 0) { // Clip top
-        h += y1;
-        y1 = 0;
-    }
-    if (x2 >= m_width) { // Clip right
-        x2 = m_width - 1;
-        w = x2 - x1 + 1;
-    }
-    if (y2 >= m_height) { // Clip bottom
-        y2 = m_height - 1;
-        h = y2 - y1 + 1;
-    }
-
-    setAddrWindow(x1, y1, x2, y2);
+    setAddrWindow(x1, y1, x1 + w - 1, y1 + h - 1);
     flood(fillcolor, (uint32_t)w * (uint32_t)h);
 }
 
@@ -406,13 +591,11 @@ void HX8357::fillScreen(uint16_t color)
 void HX8357::drawPixel(int16_t x, int16_t y, uint16_t color) 
 {
     // Clip
-    if ((x < 0) || (y < 0) || (x >= m_width) || (y >= m_height))
+    if ((x < m_clipX1) || (y < m_clipY1) || (x > m_clipX2) || (y > m_clipY2))
         return;
 
     setAddrWindow(x, y, m_width - 1, m_height - 1);
-    CD_COMMAND;
-    write8(HX8357_RAMWR);
-    CD_DATA;
+    writeCommand(HX8357_RAMWR);
     write8((uint8_t)(color >> 8));
     write8((uint8_t)(color & 0xFF));
 }
@@ -420,14 +603,341 @@ void HX8357::drawPixel(int16_t x, int16_t y, uint16_t color)
 // -----------------------------------------------------------------------------
 void HX8357::pushColors(const uint16_t *data, uint32_t len) 
 {
-    CD_COMMAND;
-    write8(HX8357_RAMWR);
-    CD_DATA;
-    for( uint32_t i = 0 ; i < len ; i++ )
+    writeCommand(HX8357_RAMWR);
+    writePixels(data, len);
+}
+
+// -----------------------------------------------------------------------------
+//  ピクセルデータを送出する(RAMWR 送出済みであること)
+//  同色ピクセルの連続(ラン)を検出し、上位・下位バイトが等しいランは
+//  ストローブのみで送出する。それ以外もバス上の値と同じバイトはピンを更新しない
+//  (アンチエイリアス文字やアイコンの背景部分、ジャケット画像の黒い余白など)
+// -----------------------------------------------------------------------------
+void HX8357::writePixels(const uint16_t *data, uint32_t len)
+{
+    const uint16_t *end = data + len;
+    while( data < end )
+    {
+        uint16_t color = *data++;
+        uint32_t run = 1;
+        while( (data < end) && (*data == color) )
+        {
+            data++;
+            run++;
+        }
+        uint8_t hi = (uint8_t)(color >> 8);
+        uint8_t lo = (uint8_t)(color & 0xFF);
+        if( hi == lo )
+        {
+            writeData8(hi);
+            for( uint32_t n = 2*run - 1 ; n-- ; )
+            {
+                WR_STROBE;
+            }
+#ifdef HX8357_STATS
+            m_stats.busBytes += 2*run - 1;
+            m_stats.strobeOnly += 2*run - 1;
+#endif
+#ifdef HX8357_MIRROR
+            m_mirror.repeat(hi, 2*run - 1);
+#endif
+        }
+        else
+        {
+            while( run-- )
+            {
+                writeData8(hi);
+                write8(lo);
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  ピクセル転送
+//  ステージングバッファは２面あり、一方を転送している間にもう一方へ次の画像を
+//  描き込むことができる。
+//    getStagingBuffer() で空いている方のバッファを得て画像を描き込み、
+//    submitBitmap() で転送を依頼する(前回の転送が終わるまでは待たされる)。
+//  HX8357_ASYNC を定義するとタイマ割り込みで少しずつ転送するので、
+//  submitBitmap() や flood() は転送の完了を待たずに戻る。
+//  定義しない場合はその場で転送を済ませる。
+//  バスを使う処理はすべて writeCommand() を通るので、そこで wait() している。
+// -----------------------------------------------------------------------------
+uint16_t HX8357::m_staging[2][HX8357::STAGING_PIXELS];
+const uint16_t * volatile HX8357::m_txData = nullptr;
+volatile uint16_t HX8357::m_txColor = 0;
+volatile uint32_t HX8357::m_txRemain = 0;
+
+#ifdef HX8357_ASYNC
+static IntervalTimer s_transferTimer;
+#endif
+
+// -----------------------------------------------------------------------------
+uint16_t *HX8357::getStagingBuffer()
+{
+    return m_staging[this->m_stagingIndex];
+}
+
+// -----------------------------------------------------------------------------
+void HX8357::submitBitmap(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    int16_t cx = x, cy = y, cw = w, ch = h;
+    if( !this->clip(&cx, &cy, &cw, &ch) )
+    {
+        return;
+    }
+    if( (cw != w) || (ch != h) )
+    {
+        // クリップ範囲に残る部分をバッファの先頭に詰める(移動先は常に移動元より前)
+        uint16_t *buffer = m_staging[this->m_stagingIndex];
+        for( int16_t row = 0 ; row < ch ; row++ )
+        {
+            memmove(buffer + row * cw, buffer + (cy - y + row) * w + (cx - x), cw * sizeof(uint16_t));
+        }
+        x = cx;
+        y = cy;
+        w = cw;
+        h = ch;
+    }
+    uint32_t len = ((uint32_t)w) * ((uint32_t)h);
+    setAddrWindow(x, y, x+w-1, y+h-1);
+    writeCommand(HX8357_RAMWR);
+    startTransfer(m_staging[this->m_stagingIndex], 0, len);
+    this->m_stagingIndex ^= 1;
+}
+
+// -----------------------------------------------------------------------------
+//  (x, y, w, h) へのピクセルの逐次送出を始める
+//  以降 pushRun(), pushPixels() で左上から w×h ピクセルを順に送る
+//  (圧縮された画像を展開しながら送る場合など)
+//  範囲がクリップ範囲からはみ出す場合は何もせず false を返す
+// -----------------------------------------------------------------------------
+bool HX8357::beginPixels(int16_t x, int16_t y, int16_t w, int16_t h)
+{
+    if( (w <= 0) || (h <= 0) || (x < this->m_clipX1) || (y < this->m_clipY1) ||
+        (x + w - 1 > this->m_clipX2) || (y + h - 1 > this->m_clipY2) )
+    {
+        return false;
+    }
+    setAddrWindow(x, y, x+w-1, y+h-1);
+    writeCommand(HX8357_RAMWR);
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+//  同じ色を len ピクセル送る(beginPixels() の後で使う)
+// -----------------------------------------------------------------------------
+void HX8357::pushRun(uint16_t color, uint32_t len)
+{
+    if( len == 0 )
+    {
+        return;
+    }
+    wait();
+    writeColor(color, len);
+}
+
+// -----------------------------------------------------------------------------
+//  ピクセルデータを len ピクセル送る(beginPixels() の後で使う)
+// -----------------------------------------------------------------------------
+void HX8357::pushPixels(const uint16_t *data, uint32_t len)
+{
+    if( len == 0 )
+    {
+        return;
+    }
+    wait();
+    writePixels(data, len);
+}
+
+// -----------------------------------------------------------------------------
+//  転送中のデータがなくなるまで待つ
+// -----------------------------------------------------------------------------
+void HX8357::wait()
+{
+    while( m_txRemain ){}
+}
+
+// -----------------------------------------------------------------------------
+//  ピクセル転送を開始する(data が nullptr なら color で塗りつぶす)
+// -----------------------------------------------------------------------------
+void HX8357::startTransfer(const uint16_t *data, uint16_t color, uint32_t len)
+{
+    if( len == 0 )
+    {
+        return;
+    }
+#ifdef HX8357_ASYNC
+    m_txData   = data;
+    m_txColor  = color;
+    m_txRemain = len;
+    s_transferTimer.begin(HX8357::transferProc, HX8357::TRANSFER_INTERVAL);
+#else
+    if( data )
+    {
+        writePixels(data, len);
+    }
+    else
+    {
+        writeColor(color, len);
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//  タイマ割り込みから呼ばれ、TRANSFER_CHUNK ピクセルずつ転送する
+//  割り込み間隔は実際に転送にかかった時間の TRANSFER_DUTY 倍に合わせ直す
+//  (統計やミラーを有効にするとバイトあたりの時間が延びるため、
+//   固定の間隔では割り込みが詰まって CPU が空かなくなる)
+// -----------------------------------------------------------------------------
+void HX8357::transferProc()
+{
+#ifdef HX8357_ASYNC
+    uint32_t start = ARM_DWT_CYCCNT;
+#endif
+    uint32_t len = m_txRemain;
+    if( len > HX8357::TRANSFER_CHUNK )
+    {
+        len = HX8357::TRANSFER_CHUNK;
+    }
+    if( m_txData )
+    {
+        writePixels(m_txData, len);
+        m_txData += len;
+    }
+    else
+    {
+        writeColor(m_txColor, len);
+    }
+    m_txRemain -= len;
+#ifdef HX8357_ASYNC
+    if( m_txRemain == 0 )
+    {
+        s_transferTimer.end();
+    }
+    else
+    {
+        uint32_t us = (ARM_DWT_CYCCNT - start) / (F_CPU_ACTUAL / 1000000) + 1;
+        uint32_t interval = us * HX8357::TRANSFER_DUTY;
+        if( interval < HX8357::TRANSFER_INTERVAL )
+        {
+            interval = HX8357::TRANSFER_INTERVAL;
+        }
+        s_transferTimer.update(interval);
+    }
+#endif
+}
+
+// -----------------------------------------------------------------------------
+//  GRAM の読み出し
+//  RAMRD の後、ダミー１バイトに続いて１ピクセルあたり R, G, B の３バイト
+//  (各上位 6bit が有効)が返るので RGB565 に詰め直す
+// -----------------------------------------------------------------------------
+void HX8357::readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *buffer)
+{
+    if( (w <= 0) || (h <= 0) )
+    {
+        return;
+    }
+    // 画面外の部分は読まずに 0 とし、buffer 上の位置(幅 w)は変えない
+    int16_t x1 = max(x, (int16_t)0);
+    int16_t y1 = max(y, (int16_t)0);
+    int16_t x2 = min((int16_t)(x + w - 1), (int16_t)(m_width - 1));
+    int16_t y2 = min((int16_t)(y + h - 1), (int16_t)(m_height - 1));
+    if( (x1 != x) || (y1 != y) || (x2 != x + w - 1) || (y2 != y + h - 1) )
+    {
+        memset(buffer, 0, ((uint32_t)w) * ((uint32_t)h) * sizeof(uint16_t));
+    }
+    if( (x1 > x2) || (y1 > y2) )
+    {
+        return;
+    }
+    buffer += ((uint32_t)(y1 - y)) * w + (x1 - x);
+    if( (x1 == x) && (x2 == x + w - 1) )
+    {
+        readWindow(x1, y1, x2, y2, buffer);
+        return;
+    }
+    // 左右がはみ出す場合は１行ずつ読む
+    for( int16_t row = y1 ; row <= y2 ; row++ )
+    {
+        readWindow(x1, row, x2, row, buffer);
+        buffer += w;
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  画面内に収まっているウィンドウを読み出す
+// -----------------------------------------------------------------------------
+void HX8357::readWindow(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t *buffer)
+{
+    uint32_t len = ((uint32_t)(x2 - x1 + 1)) * ((uint32_t)(y2 - y1 + 1));
+    setAddrWindow(x1, y1, x2, y2);
+    writeCommand(HX8357_RAMRD);
+    setBusDirection(INPUT);
+    read8();
+    while( len-- )
+    {
+        uint8_t r = read8();
+        uint8_t g = read8();
+        uint8_t b = read8();
+        *buffer++ = ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
+    }
+    setBusDirection(OUTPUT);
+}
+
+// -----------------------------------------------------------------------------
+uint16_t HX8357::readPixel(int16_t x, int16_t y)
+{
+    if( (x < 0) || (y < 0) || (x >= m_width) || (y >= m_height) )
+    {
+        return 0;
+    }
+    uint16_t color;
+    readRect(x, y, 1, 1, &color);
+    return color;
+}
+
+// -----------------------------------------------------------------------------
+//  フレーム同期
+//  パネルはフレームの先頭(TEARLINE で指定したライン)で TE 信号を出す。
+//  TE の直後に描画を済ませれば走査中の書き換えによるちらつきが起きない。
+//  HX8357_TE_PIN が未定義の場合は TE を受け取れないので、フレーム周期で
+//  時刻を進めるだけの推定になる(描画の間隔は揃うが位相は合わない)
+// -----------------------------------------------------------------------------
+volatile uint32_t HX8357::m_frameTime = 0;
+volatile uint32_t HX8357::m_frameCount = 0;
+
+// -----------------------------------------------------------------------------
+void HX8357::onTearing()
+{
+    m_frameTime = micros();
+    m_frameCount++;
+}
+
+// -----------------------------------------------------------------------------
+//  現在 TE 直後の描画してよい期間か
+// -----------------------------------------------------------------------------
+bool HX8357::isTearWindow()
+{
+#ifndef HX8357_TE_PIN
+    uint32_t elapsed = micros() - m_frameTime;
+    if( elapsed >= HX8357::FRAME_PERIOD )
     {
-        write8((uint8_t)(data[i] >> 8));
-        write8((uint8_t)(data[i] & 0xFF));
+        uint32_t frames = elapsed / HX8357::FRAME_PERIOD;
+        m_frameTime += frames * HX8357::FRAME_PERIOD;
+        m_frameCount += frames;
     }
+#endif
+    return (micros() - m_frameTime) < HX8357::TEAR_WINDOW;
+}
+
+// -----------------------------------------------------------------------------
+uint32_t HX8357::getFrameCount()
+{
+    isTearWindow();
+    return m_frameCount;
 }
 
 // -----------------------------------------------------------------------------
@@ -460,10 +970,10 @@ void HX8357::setRotation(uint8_t x)
             this->m_height = HX8357_TFTWIDTH;
             break;
     }
-    CD_COMMAND;
-    write8(HX8357_MADCTL);
-    CD_DATA;
+    this->setClipRect();
+    writeCommand(HX8357_MADCTL);
     write8(t);
+    invalidateAddrWindow();
     // For 8357, init default full-screen address window:
     setAddrWindow(0, 0, m_width - 1, m_height - 1);
 }
@@ -471,25 +981,171 @@ void HX8357::setRotation(uint8_t x)
 // -----------------------------------------------------------------------------
 void HX8357::drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap)
 {
-    uint32_t len = ((uint32_t)w) * ((uint32_t)h);
-    setAddrWindow(x, y, x+w-1, y+h-1);
-    pushColors(bitmap, len);
+    int16_t cx = x, cy = y, cw = w, ch = h;
+    if( !this->clip(&cx, &cy, &cw, &ch) )
+    {
+        return;
+    }
+    bitmap += (cy - y) * w + (cx - x);
+    if( cw == w )
+    {
+        // 列が欠けていなければ行は連続している
+        setAddrWindow(cx, cy, cx+cw-1, cy+ch-1);
+        pushColors(bitmap, ((uint32_t)cw) * ((uint32_t)ch));
+        return;
+    }
+    // クリップ範囲に残る部分を１行ずつ送る(カラム範囲は共通なので CASET は省略される)
+    for( int16_t row = 0 ; row < ch ; row++ )
+    {
+        setAddrWindow(cx, cy+row, cx+cw-1, cy+row);
+        pushColors(bitmap + row * w, cw);
+    }
 }
 
+// -----------------------------------------------------------------------------
+//  1bitフォントのグリフを描画する
+//  グリフデータは列単位(glyph[i] の bit j が (i, j) のピクセル)なので、
+//  展開時に行優先に並べ替え、グリフ全体を１つのアドレスウィンドウで転送する
 // -----------------------------------------------------------------------------
 void HX8357::drawGlyph(int16_t x, int16_t y, int16_t w, int16_t h, const uint32_t *glyph, uint16_t fgcol, uint16_t bkcol)
 {
-    uint16_t buffer[32];
+    enum{MAX_COLUMNS = 32};
+
+    // クリップ範囲外の列と行を除く
+    int16_t first = max((int16_t)(this->m_clipX1 - x), (int16_t)0);
+    int16_t last = min((int16_t)(this->m_clipX2 + 1 - x), w);
+    int16_t top = max((int16_t)(this->m_clipY1 - y), (int16_t)0);
+    int16_t bottom = min((int16_t)(this->m_clipY2 + 1 - y), h);
+    if( top >= bottom )
+    {
+        return;
+    }
+    while( first < last )
+    {
+        int16_t cols = last - first;
+        if( cols > MAX_COLUMNS ){ cols = MAX_COLUMNS; }
+        uint16_t *p = this->getStagingBuffer();
+        for( int16_t j = top ; j < bottom ; j++ )
+        {
+            uint32_t mask = ((uint32_t)1) << j;
+            for( int16_t i = first ; i < first+cols ; i++ )
+            {
+                *p++ = (glyph[i] & mask)? fgcol : bkcol;
+            }
+        }
+        this->submitBitmap(x+first, y+top, cols, bottom-top);
+        first += cols;
+    }
+}
+
+#ifdef HX8357_MIRROR
+// -----------------------------------------------------------------------------
+//  drawGlyph() が、以前の列ごとの転送(１列ずつアドレスウィンドウを開く)と
+//  同じ画面になることを写しのフレームバッファで確かめる(違っていた画素数を返す)
+//  画面端やクリップ範囲にかかる位置、32 列を超える幅(分割転送)を試す
+//  画面は黒で塗りつぶして終わる
+// -----------------------------------------------------------------------------
+uint32_t HX8357::selfTestGlyph()
+{
+    enum{W = 40, H = 24, MARGIN = 1, AREA = (W+2*MARGIN)*(H+2*MARGIN)};
+    enum{FGCOL = 0xFFE0, BKCOL = 0x001F, FILL = 0xF81F};
+    static uint16_t expected[AREA];
+    uint32_t glyph[W];
+    uint32_t seed = 12345;
+    for( int16_t i = 0 ; i < W ; i++ )
+    {
+        seed = seed * 1103515245 + 12345;
+        glyph[i] = seed;
+    }
+    glyph[0] = 0;               // 全部背景の列
+    glyph[W-1] = 0xFFFFFFFF;    // 全部前景の列
+
+    struct Case{ int16_t x, y, w, h; int16_t clipX, clipY, clipW, clipH; };
+    const int16_t sw = this->m_width;
+    const int16_t sh = this->m_height;
+    const int16_t right = sw - 17;
+    const Case cases[] = {
+        {   10,  10,  W,  H,   0,   0, sw,       sh},   // 分割転送
+        {   60,  10, 12,  H,   0,   0, sw,       sh},   // 1 回の転送
+        {   -7,  50,  W,  H,   0,   0, sw,       sh},   // 左端
+        {right,  50,  W,  H,   0,   0, sw,       sh},   // 右端
+        {  100, 100,  W,  H, 105, 104, 25,       12},   // クリップ範囲(上下左右)
+        {  200, 100, 17, 20,   0, 110, sw, sh - 110},   // クリップ範囲(上)
+    };
 
-    for( int16_t i = 0 ; i < w ; i++ )
+    uint32_t errors = 0;
+    for( uint16_t c = 0 ; c < sizeof(cases) / sizeof(cases[0]) ; c++ )
     {
-        if( i+x < 0 ){ continue; }
-        if( i+x >= this->m_width ){ break; }
-        for( int16_t j = 0 ; j < h ; j++ )
+        const Case& t = cases[c];
+        int16_t left = t.x - MARGIN;
+        int16_t top = t.y - MARGIN;
+        int16_t width = t.w + 2*MARGIN;
+        int16_t height = t.h + 2*MARGIN;
+
+        // 以前の方法 : クリップ範囲内の列ごとに 1 列のウィンドウで送る
+        this->setClipRect();
+        this->fillRect(left, top, width, height, FILL);
+        this->setClipRect(t.clipX, t.clipY, t.clipW, t.clipH);
+        int16_t y1 = max(t.y, this->m_clipY1);
+        int16_t y2 = min((int16_t)(t.y + t.h - 1), this->m_clipY2);
+        uint16_t column[32];
+        for( int16_t i = 0 ; (i < t.w) && (y1 <= y2) ; i++ )
+        {
+            if( (t.x+i < this->m_clipX1) || (t.x+i > this->m_clipX2) ){ continue; }
+            for( int16_t j = y1 ; j <= y2 ; j++ )
+            {
+                column[j-y1] = (glyph[i] & (((uint32_t)1) << (j-t.y)))? FGCOL : BKCOL;
+            }
+            setAddrWindow(t.x+i, y1, t.x+i, y2);
+            pushColors(column, y2-y1+1);
+        }
+        wait();
+        for( int16_t j = 0 ; j < height ; j++ )
+        {
+            for( int16_t i = 0 ; i < width ; i++ )
+            {
+                expected[j*width+i] = m_mirror.getPixel(left+i, top+j);
+            }
+        }
+
+        // drawGlyph()
+        this->setClipRect();
+        this->fillRect(left, top, width, height, FILL);
+        this->setClipRect(t.clipX, t.clipY, t.clipW, t.clipH);
+        this->drawGlyph(t.x, t.y, t.w, t.h, glyph, FGCOL, BKCOL);
+        wait();
+        uint32_t drawn = 0;
+        for( int16_t j = 0 ; j < height ; j++ )
+        {
+            for( int16_t i = 0 ; i < width ; i++ )
+            {
+                uint16_t actual = m_mirror.getPixel(left+i, top+j);
+                if( (actual == FGCOL) || (actual == BKCOL) )
+                {
+                    drawn++;
+                }
+                if( actual != expected[j*width+i] )
+                {
+                    if( errors < 8 )
+                    {
+                        Serial.printf("drawGlyph: case %d (%d, %d) : %04X != %04X\n",
+                            c, left+i, top+j, actual, expected[j*width+i]);
+                    }
+                    errors++;
+                }
+            }
+        }
+        // 何も描かれなければ確かめたことにならないので失敗とする
+        if( drawn == 0 )
         {
-            buffer[j] = (glyph[i] & (1 << j))? fgcol : bkcol;
+            Serial.printf("drawGlyph: case %d : nothing drawn\n", c);
+            errors++;
         }
-        setAddrWindow(x+i, y, x+i, y+h-1);
-        pushColors(buffer, h);
     }
+    this->setClipRect();
+    this->fillScreen(0);
+    wait();
+    Serial.printf("drawGlyph self test : %lu errors\n", (unsigned long)errors);
+    return errors;
 }
+#endif
@@ -36,7 +36,7 @@
 #define HX8357_CASET   0x2A
 #define HX8357_PASET   0x2B
 #define HX8357_RAMWR   0x2C
-// #define HX8357_RAMRD   0x2E
+#define HX8357_RAMRD   0x2E
 
 // #define HX8357B_PTLAR    0x30
 #define HX8357_TEON  0x35
@@ -87,23 +87,97 @@
 #define HX8357_MADCTL_BGR 0x08 ///< Blue-Green-Red pixel order
 #define HX8357_MADCTL_MH  0x04 ///< LCD refresh right to left
 
+// 有効にするとバス転送量の統計を取る(性能評価用)
+// #define HX8357_STATS
+
+// 有効にするとピクセル転送をタイマ割り込みで行い、転送中も CPU を解放する
+// #define HX8357_ASYNC
+
+// 有効にすると送出したコマンド列を解釈してフレームバッファに写す(PSRAM 必須、デバッグ用)
+// 実機上でのみ動作する(PC 向けのビルドはない)
+// #define HX8357_MIRROR
+
+#ifdef HX8357_MIRROR
+#include "HX8357Mirror.h"
+#endif
+
+// TE(テアリングエフェクト)信号を接続したピン
+// 未接続の場合はフレーム周期から描画タイミングを推定する
+// #define HX8357_TE_PIN  41
+
+#ifdef HX8357_STATS
+struct HX8357Stats
+{
+    uint32_t commands;      // 送信したコマンド数
+    uint32_t busBytes;      // バスに送出したバイト数(コマンド・データの合計)
+    uint32_t portWrites;    // データピン(D0～D7)のポートレジスタへの書き込み回数
+    uint32_t strobeOnly;    // データピンを更新せずストローブのみで送出したバイト数
+    uint32_t windowBytesSaved;  // アドレスウィンドウのキャッシュにより省略したバイト数
+};
+#endif
+
 class HX8357
 {
+    public:
+        enum{STAGING_PIXELS = 48*48};   // ステージングバッファ１面のピクセル数
+        enum{FRAME_PERIOD = 14286};     // １フレームの時間(us)(SETOSC : 70Hz)
+        enum{TEAR_WINDOW = 4000};       // TE からこの時間(us)内は描画してよい
     private:
+        enum{TRANSFER_CHUNK = 64};      // 割り込み１回で転送するピクセル数
+        enum{TRANSFER_BYTE_NS = 40};    // バス１バイトの送出時間の見積もり(ns)
+        enum{TRANSFER_CHUNK_US = (TRANSFER_CHUNK * 2 * TRANSFER_BYTE_NS + 999) / 1000};
+        enum{TRANSFER_DUTY = 4};        // 割り込み間隔は転送時間のこの倍数(CPU の 1/4 まで使う)
+        enum{TRANSFER_INTERVAL = TRANSFER_CHUNK_US * TRANSFER_DUTY};   // 最初の割り込み間隔(us)
         int16_t m_width;
         int16_t m_height;
+        int16_t m_windowX1;             // 現在のアドレスウィンドウ(CASET)
+        int16_t m_windowX2;
+        int16_t m_windowY1;             // 現在のアドレスウィンドウ(PASET)
+        int16_t m_windowY2;
+        int16_t m_clipX1;               // クリップ範囲(この外には描画しない)
+        int16_t m_clipY1;
+        int16_t m_clipX2;
+        int16_t m_clipY2;
+        static uint16_t m_busValue;     // 現在データバスに出ている値
+        int             m_stagingIndex; // 次に描き込むステージングバッファ
+        static uint16_t m_staging[2][STAGING_PIXELS];
+        static const uint16_t * volatile m_txData;   // 転送中のデータ(nullptr なら塗りつぶし)
+        static volatile uint16_t m_txColor;            // 塗りつぶし色
+        static volatile uint32_t m_txRemain;           // 未転送のピクセル数
+        static volatile uint32_t m_frameTime;       // 直前のフレーム開始時刻(us)
+        static volatile uint32_t m_frameCount;
+#ifdef HX8357_STATS
+        static HX8357Stats m_stats;
+#endif
+#ifdef HX8357_MIRROR
+        static HX8357Mirror m_mirror;
+#endif
         void init();
         void reset();
         void setAddrWindow(int16_t x1, int16_t y1, int16_t x2, int16_t y2); 
+        void invalidateAddrWindow();
         void flood(uint16_t color, uint32_t len); 
         void setAddr(uint16_t x0, uint16_t y0, uint16_t x1, uint16_t y1);
+        bool clip(int16_t *x, int16_t *y, int16_t *w, int16_t *h);
+        void readWindow(int16_t x1, int16_t y1, int16_t x2, int16_t y2, uint16_t *buffer);
         void pushColors(const uint16_t *data, uint32_t len);
+        static void writePixels(const uint16_t *data, uint32_t len);
+        static void writeColor(uint16_t color, uint32_t len);
+        static void startTransfer(const uint16_t *data, uint16_t color, uint32_t len);
+        static void transferProc();
         static void write8(uint8_t c);
+        static void writeData8(uint8_t c);
+        static void writeCommand(uint8_t c);
+        static uint8_t read8();
+        static void setBusDirection(uint8_t mode);
+        static void onTearing();
 
     public:
         HX8357();
         void begin();
         void setRotation(uint8_t m);
+        void setClipRect(int16_t x, int16_t y, int16_t w, int16_t h);
+        void setClipRect();
         void drawFastVLine(int16_t x, int16_t y, int16_t h, uint16_t color);
         void drawFastHLine(int16_t x, int16_t y, int16_t w, uint16_t color);
         void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
@@ -112,9 +186,29 @@ class HX8357
         void drawPixel(int16_t x, int16_t y, uint16_t color);
         void drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *bitmap);
         void drawGlyph(int16_t x, int16_t y, int16_t w, int16_t h, const uint32_t *glyph, uint16_t fgcol, uint16_t bkcol);
+        uint16_t *getStagingBuffer();
+        void submitBitmap(int16_t x, int16_t y, int16_t w, int16_t h);
+        bool beginPixels(int16_t x, int16_t y, int16_t w, int16_t h);
+        void pushRun(uint16_t color, uint32_t len);
+        void pushPixels(const uint16_t *data, uint32_t len);
+        uint16_t readPixel(int16_t x, int16_t y);
+        void readRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *buffer);
+        static void wait();
+        static bool isTearWindow();
+        static uint32_t getFrameCount();
 
         int16_t getWidth(){ return this->m_width; }
         int16_t getHeight(){ return this->m_height; }
+
+#ifdef HX8357_STATS
+        static const HX8357Stats& getStats(){ return m_stats; }
+        static void resetStats();
+        static void printStats(const char *label);
+#endif
+#ifdef HX8357_MIRROR
+        static HX8357Mirror& getMirror(){ return m_mirror; }
+        uint32_t selfTestGlyph();
+#endif
 };
 
 #endif
@@ -0,0 +1,313 @@
+// -----------------------------------------------------------------------------
+//  HX8357Mirror.cpp
+//  HX8357D コマンドストリームのデコーダ(デバッグ用)
+// -----------------------------------------------------------------------------
+#include <Arduino.h>
+#include <SD.h>
+#include "HX8357.h"
+#include "HX8357Mirror.h"
+
+#ifdef HX8357_MIRROR
+
+/*
+    HX8357 の write8() 等から送出バイトを受け取り、次のコマンドを解釈する
+        SWRESET : 状態を初期化
+        CASET   : カラム範囲
+        PASET   : ページ範囲
+        RAMWR   : ピクセル書き込み(ウィンドウ内を左→右、上→下、末尾で先頭に戻る)
+        RAMRD   : ピクセル読み出し(ダミー１バイトの後、R, G, B の順に返す)
+        MADCTL  : MV/MX/MY によるアドレスと GRAM の対応
+    その他のコマンドはパラメータごと読み捨てる。
+    フレームバッファ(320×480×2 = 300KB)は PSRAM に置く。
+*/
+
+// -----------------------------------------------------------------------------
+EXTMEM static uint16_t s_mirrorFrame[HX8357Mirror::WIDTH * HX8357Mirror::HEIGHT];
+
+// -----------------------------------------------------------------------------
+HX8357Mirror::HX8357Mirror() : m_frame(s_mirrorFrame)
+{
+    this->reset();
+    this->resetCounters();
+}
+
+// -----------------------------------------------------------------------------
+void HX8357Mirror::begin()
+{
+    memset(this->m_frame, 0, sizeof(s_mirrorFrame));
+    this->reset();
+    this->resetCounters();
+}
+
+// -----------------------------------------------------------------------------
+void HX8357Mirror::reset()
+{
+    this->m_command = false;
+    this->m_current = 0;
+    this->m_numParams = 0;
+    this->m_madctl = 0;
+    this->m_columnStart = this->m_column = 0;
+    this->m_columnEnd = HX8357Mirror::WIDTH - 1;
+    this->m_pageStart = this->m_page = 0;
+    this->m_pageEnd = HX8357Mirror::HEIGHT - 1;
+    this->m_highByte = false;
+    this->m_pixelHigh = 0;
+    this->m_readPhase = 0;
+}
+
+// -----------------------------------------------------------------------------
+void HX8357Mirror::resetCounters()
+{
+    memset(&this->m_counters, 0, sizeof(this->m_counters));
+}
+
+// -----------------------------------------------------------------------------
+void HX8357Mirror::printCounters(const char *label)
+{
+    Serial.printf("[%s] mirror: bytes=%lu commands=%lu pixels=%lu\n", label,
+        (unsigned long)this->m_counters.bytes, (unsigned long)this->m_counters.commands,
+        (unsigned long)this->m_counters.pixels);
+}
+
+// -----------------------------------------------------------------------------
+void HX8357Mirror::command(uint8_t c)
+{
+    this->m_counters.bytes++;
+    this->m_counters.commands++;
+    this->m_current = c;
+    this->m_numParams = 0;
+    this->m_highByte = false;
+
+    switch( c )
+    {
+        case HX8357_SWRESET:
+            this->reset();
+            break;
+        case HX8357_RAMWR:
+        case HX8357_RAMRD:
+            this->m_column = this->m_columnStart;
+            this->m_page = this->m_pageStart;
+            this->m_readPhase = 0;
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+void HX8357Mirror::data(uint8_t c)
+{
+    this->m_counters.bytes++;
+
+    if( this->m_current == HX8357_RAMWR )
+    {
+        if( this->m_highByte )
+        {
+            this->m_highByte = false;
+            this->writePixel((((uint16_t)this->m_pixelHigh) << 8) | c);
+        }
+        else
+        {
+            this->m_highByte = true;
+            this->m_pixelHigh = c;
+        }
+        return;
+    }
+
+    if( this->m_numParams >= HX8357Mirror::MAX_PARAMS )
+    {
+        return;
+    }
+    this->m_params[this->m_numParams++] = c;
+
+    switch( this->m_current )
+    {
+        case HX8357_CASET:
+            if( this->m_numParams == 4 )
+            {
+                this->m_columnStart = (this->m_params[0] << 8) | this->m_params[1];
+                this->m_columnEnd   = (this->m_params[2] << 8) | this->m_params[3];
+            }
+            break;
+        case HX8357_PASET:
+            if( this->m_numParams == 4 )
+            {
+                this->m_pageStart = (this->m_params[0] << 8) | this->m_params[1];
+                this->m_pageEnd   = (this->m_params[2] << 8) | this->m_params[3];
+            }
+            break;
+        case HX8357_MADCTL:
+            this->m_madctl = c;
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  同じバイトを count 回受け取る(ストローブのみの送出)
+// -----------------------------------------------------------------------------
+void HX8357Mirror::repeat(uint8_t c, uint32_t count)
+{
+    while( count-- )
+    {
+        this->write(c);
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  カラム・ページアドレスを GRAM 上の位置に変換する(範囲外なら 0xFFFFFFFF)
+// -----------------------------------------------------------------------------
+uint32_t HX8357Mirror::offset(int16_t column, int16_t page)
+{
+    int16_t x = column;
+    int16_t y = page;
+    if( this->m_madctl & HX8357_MADCTL_MV )
+    {
+        x = page;
+        y = column;
+    }
+    if( (x < 0) || (x >= HX8357Mirror::WIDTH) || (y < 0) || (y >= HX8357Mirror::HEIGHT) )
+    {
+        return 0xFFFFFFFF;
+    }
+    if( this->m_madctl & HX8357_MADCTL_MX )
+    {
+        x = HX8357Mirror::WIDTH - 1 - x;
+    }
+    if( this->m_madctl & HX8357_MADCTL_MY )
+    {
+        y = HX8357Mirror::HEIGHT - 1 - y;
+    }
+    return ((uint32_t)y) * HX8357Mirror::WIDTH + x;
+}
+
+// -----------------------------------------------------------------------------
+void HX8357Mirror::writePixel(uint16_t color)
+{
+    this->m_counters.pixels++;
+
+    uint32_t n = this->offset(this->m_column, this->m_page);
+    if( n != 0xFFFFFFFF )
+    {
+        this->m_frame[n] = color;
+    }
+    this->advance();
+}
+
+// -----------------------------------------------------------------------------
+//  ウィンドウ内の次の位置に進む
+// -----------------------------------------------------------------------------
+void HX8357Mirror::advance()
+{
+    if( ++this->m_column > this->m_columnEnd )
+    {
+        this->m_column = this->m_columnStart;
+        if( ++this->m_page > this->m_pageEnd )
+        {
+            this->m_page = this->m_pageStart;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  RAMRD に対してパネルが返すバイト
+//  各色の上位ビットに値が入る(RGB565 の各成分を 8bit に広げて返す)
+// -----------------------------------------------------------------------------
+uint8_t HX8357Mirror::read()
+{
+    if( this->m_current != HX8357_RAMRD )
+    {
+        return 0;
+    }
+    if( this->m_readPhase == 0 )
+    {
+        this->m_readPhase = 1;
+        return 0;
+    }
+    uint16_t c = 0;
+    uint32_t n = this->offset(this->m_column, this->m_page);
+    if( n != 0xFFFFFFFF )
+    {
+        c = this->m_frame[n];
+    }
+    uint8_t v;
+    switch( this->m_readPhase )
+    {
+        case 1:
+            v = (c >> 11) & 0x1F;
+            v = (v << 3) | (v >> 2);
+            this->m_readPhase = 2;
+            break;
+        case 2:
+            v = (c >> 5) & 0x3F;
+            v = (v << 2) | (v >> 4);
+            this->m_readPhase = 3;
+            break;
+        default:
+            v = c & 0x1F;
+            v = (v << 3) | (v >> 2);
+            this->m_readPhase = 1;
+            this->advance();
+            break;
+    }
+    return v;
+}
+
+// -----------------------------------------------------------------------------
+//  現在の MADCTL から見た画面の大きさ
+// -----------------------------------------------------------------------------
+int16_t HX8357Mirror::getWidth()
+{
+    return (this->m_madctl & HX8357_MADCTL_MV)? HX8357Mirror::HEIGHT : HX8357Mirror::WIDTH;
+}
+
+int16_t HX8357Mirror::getHeight()
+{
+    return (this->m_madctl & HX8357_MADCTL_MV)? HX8357Mirror::WIDTH : HX8357Mirror::HEIGHT;
+}
+
+// -----------------------------------------------------------------------------
+uint16_t HX8357Mirror::getPixel(int16_t x, int16_t y)
+{
+    uint32_t n = this->offset(x, y);
+    return (n != 0xFFFFFFFF)? this->m_frame[n] : 0;
+}
+
+// -----------------------------------------------------------------------------
+//  画面の内容を PPM(P6) 形式で SD カードに書き出す
+// -----------------------------------------------------------------------------
+bool HX8357Mirror::dump(const char *path)
+{
+    HX8357::wait();
+
+    SD.remove(path);
+    File f = SD.open(path, FILE_WRITE);
+    if( !f )
+    {
+        return false;
+    }
+
+    int16_t w = this->getWidth();
+    int16_t h = this->getHeight();
+    char header[32];
+    sprintf(header, "P6\n%d %d\n255\n", (int)w, (int)h);
+    f.write((const uint8_t *)header, strlen(header));
+
+    uint8_t line[HX8357Mirror::HEIGHT * 3];
+    for( int16_t y = 0 ; y < h ; y++ )
+    {
+        uint8_t *p = line;
+        for( int16_t x = 0 ; x < w ; x++ )
+        {
+            uint16_t c = this->getPixel(x, y);
+            uint8_t r = (c >> 11) & 0x1F;
+            uint8_t g = (c >>  5) & 0x3F;
+            uint8_t b = c & 0x1F;
+            *p++ = (r << 3) | (r >> 2);
+            *p++ = (g << 2) | (g >> 4);
+            *p++ = (b << 3) | (b >> 2);
+        }
+        f.write(line, p - line);
+    }
+    f.close();
+    return true;
+}
+
+#endif
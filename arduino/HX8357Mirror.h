@@ -0,0 +1,80 @@
+// -----------------------------------------------------------------------------
+//  HX8357Mirror.h
+//  HX8357D コマンドストリームのデコーダ(デバッグ用)
+//  バスに送出したバイトを解釈して、パネルと同じ内容のフレームバッファを保持する
+//  Teensy 4.1 上で実機のバス出力と並行して動かすもので、PC 上で動くエミュレータではない
+//  (フレームバッファは PSRAM(EXTMEM)、スナップショットは SD カード、カウンタは Serial に出力する)
+// -----------------------------------------------------------------------------
+
+#ifndef HX8357_MIRROR_H
+#define HX8357_MIRROR_H
+
+#include <Arduino.h>
+
+struct HX8357MirrorCounters
+{
+    uint32_t bytes;         // 受け取ったバイト数(コマンド・データの合計)
+    uint32_t commands;      // 受け取ったコマンド数
+    uint32_t pixels;        // RAMWR で書き込まれたピクセル数
+};
+
+class HX8357Mirror
+{
+    public:
+        enum{WIDTH = 320, HEIGHT = 480};    // GRAM の大きさ(パネル本来の向き)
+
+    private:
+        enum{MAX_PARAMS = 4};
+        uint16_t *m_frame;          // GRAM の写し(RGB565)
+        bool     m_command;         // 次のバイトはコマンド
+        uint8_t  m_current;         // 処理中のコマンド
+        uint8_t  m_params[MAX_PARAMS];
+        uint8_t  m_numParams;
+        uint8_t  m_madctl;
+        int16_t  m_columnStart;     // CASET
+        int16_t  m_columnEnd;
+        int16_t  m_pageStart;       // PASET
+        int16_t  m_pageEnd;
+        int16_t  m_column;          // 書き込み位置
+        int16_t  m_page;
+        bool     m_highByte;        // ピクセルの上位バイトを受け取った
+        uint8_t  m_pixelHigh;
+        uint8_t  m_readPhase;       // RAMRD で次に返すバイト(0:ダミー 1:R 2:G 3:B)
+        HX8357MirrorCounters m_counters;
+
+        void command(uint8_t c);
+        void data(uint8_t c);
+        void writePixel(uint16_t color);
+        void advance();
+        uint32_t offset(int16_t column, int16_t page);
+
+    public:
+        HX8357Mirror();
+        void begin();
+        void reset();
+        void beginCommand(){ this->m_command = true; }
+        void write(uint8_t c)
+        {
+            if( this->m_command )
+            {
+                this->m_command = false;
+                this->command(c);
+            }
+            else
+            {
+                this->data(c);
+            }
+        }
+        void repeat(uint8_t c, uint32_t count);
+        uint8_t read();
+
+        int16_t getWidth();
+        int16_t getHeight();
+        uint16_t getPixel(int16_t x, int16_t y);
+        const HX8357MirrorCounters& getCounters(){ return this->m_counters; }
+        void resetCounters();
+        void printCounters(const char *label);
+        bool dump(const char *path);
+};
+
+#endif
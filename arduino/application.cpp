@@ -11,7 +11,17 @@ Application::Application(HX8357 *display, MusicPlayer *player)
 // -----------------------------------------------------------------------------
 bool Application::begin(bool update)
 {
+#ifdef HX8357_MIRROR
+    this->m_display->selfTestGlyph();   // 画面を黒に戻してから次へ進む
+#endif
+#ifdef SHADOW_FRAME
+    ShadowFrame::begin(COLOR_BLACK);    // setup() で画面を黒で塗りつぶしている
+#endif
     this->m_desktop = new Desktop(this->m_display);
+#ifdef HX8357_STATS
+    AlphaBrender::selfTest();
+    this->m_desktop->measureImages(this->m_display);
+#endif
     this->m_desktop->refresh();
 
     uint32_t t = millis() + 2000;
@@ -147,7 +157,7 @@ void Application::onPlayerEvent(MusicPlayer *player, uint16_t eventId, void *con
             app->m_toolbar->getToolButton(ToolBar::ID_STOP)->hide();
             app->m_toolbar->getToolButton(ToolBar::ID_PLAY)->show();
         }
-        app->m_toolbar->refresh();
+        app->m_toolbar->invalidate();
     }
 }
 
@@ -221,12 +231,59 @@ void Application::switchView(uint16_t id)
     }
     this->m_activeViewID = id;
     this->m_views[id]->show();
+#ifdef HX8357_STATS
+    // 画面全体の再描画にかかるバス転送量を計測する
+    // (ディスプレイリストを使わずに一度描画し、ストリップを使わずに描画してから、
+    //  ストリップを使って描画し直す)
+    char label[24];
+    sprintf(label, "view %d direct", (int)id);
+    DisplayList::setEnabled(false);
+    HX8357::resetStats();
     this->m_views[id]->refresh();
+    HX8357::printStats(label);
+    DisplayList::setEnabled(true);
+    DisplayList::setStripEnabled(false);
+    sprintf(label, "view %d list", (int)id);
+    HX8357::resetStats();
+    this->m_views[id]->refresh();
+    HX8357::printStats(label);
+    DisplayList::setStripEnabled(true);
+    sprintf(label, "view %d strip", (int)id);
+    HX8357::resetStats();
+    GlyphCache().resetCounters();
+    IconCache().resetCounters();
+    uint32_t t = micros();
+#endif
+#ifdef HX8357_MIRROR
+    HX8357::getMirror().resetCounters();
+#endif
+    this->m_views[id]->refresh();
+#ifdef HX8357_STATS
+    HX8357::wait();
+    t = micros() - t;
+    HX8357::printStats(label);
+    Serial.printf("[%s] %luus glyph cache hits=%lu misses=%lu used=%lu\n", label, (unsigned long)t,
+        (unsigned long)GlyphCache().getHits(), (unsigned long)GlyphCache().getMisses(),
+        (unsigned long)GlyphCache().getUsedBytes());
+    Serial.printf("[%s] icon cache hits=%lu misses=%lu used=%lu\n", label,
+        (unsigned long)IconCache().getHits(), (unsigned long)IconCache().getMisses(),
+        (unsigned long)IconCache().getUsedBytes());
+#endif
+#ifdef HX8357_MIRROR
+    // 描画結果を SD カードに保存する(/view<ID>.ppm)
+    char path[16];
+    sprintf(path, "/view%d.ppm", (int)id);
+    HX8357::getMirror().printCounters(path);
+    HX8357::getMirror().dump(path);
+#endif
 }
 
 // -----------------------------------------------------------------------------
 void Application::loop(AudioAnalyzeFFT1024 *fft, TouchManager *touch)
 {
+#ifdef HX8357_STATS
+    UIWidget::resetDrawCount();
+#endif
     this->m_player->control();
     UIWidget *active = this->m_views[this->m_activeViewID];
     if( active->getID() == PlaybackView::ID )
@@ -234,6 +291,25 @@ void Application::loop(AudioAnalyzeFFT1024 *fft, TouchManager *touch)
         ((PlaybackView *)active)->updateFFT(fft);
     }
     touch->execute(this->m_desktop);   
+    // イベントやタッチで invalidate() された範囲をまとめて１回で描画する
+    this->m_desktop->update();
+    PresentScheduler::execute();
+#ifdef HX8357_STATS
+    if( UIWidget::getDrawCount() > 0 )
+    {
+        Serial.printf("[loop] widgets drawn=%lu\n", (unsigned long)UIWidget::getDrawCount());
+    }
+#endif
+#if defined(SHADOW_FRAME) && defined(HX8357_STATS)
+    // ５秒ごとに転送１回あたりのバス転送量を表示する
+    static uint32_t statsTime = millis();
+    if( millis() - statsTime >= 5000 )
+    {
+        statsTime = millis();
+        ShadowFrame::printStats("loop");
+        ShadowFrame::resetStats();
+    }
+#endif
 }
 
 // ----------------------------------------------------------------------------
@@ -259,7 +335,7 @@ void Application::showPlayback()
         this->m_toolbar->getToolButton(ToolBar::ID_STOP)->hide();
         this->m_toolbar->getToolButton(ToolBar::ID_PLAY)->show();
     }
-    this->m_toolbar->refresh();
+    this->m_toolbar->invalidate();
 }
 
 // -----------------------------------------------------------------------------
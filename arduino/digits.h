@@ -1,354 +1,129 @@
 const uint8_t SSEG_DIGITS[] PROGMEM = {
-      20, 30,
-      0,  0,  0,  0,  0,  0,128,251,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,  0,  0,  0,251,255,255,255,255,255,255,255,255,255,255,213,  0,  0,
-      0,  0,  0,  0,128,128,160,255,255,255,255,255,255,255,255,255,251,128,160,  0,
-      0,  0,  0,160,255,251,128,128,128,128,128,128,128,128,128,128,128,213,255,213,
-      0,  0,  0,255,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,
-      0,  0,128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,251,
-      0,  0,128,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,
-      0,  0,160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,192,
-      0,  0,192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,
-      0,  0,213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,128,
-      0,  0,251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,
-      0,  0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,255,  0,
-      0,  0,251,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,213,  0,
-      0,  0,128,251,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,
-      0,128,251,251,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,192,  0,  0,
-      0,213,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-    128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-    128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-    160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-    192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-    213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-    251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-    251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-    160,255,192,128,192,192,192,192,192,192,192,192,192,  0,213,251,128,  0,  0,  0,
-      0,128,128,251,255,255,255,255,255,255,255,255,255,213,  0,128,  0,  0,  0,  0,
-      0,  0,192,255,255,255,255,255,255,255,255,255,255,251,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,192,251,251,251,251,251,251,251,251,192,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,213,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,251,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,192,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,128,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,255,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,213,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,251,128,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,128,251,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,  0,  0,  0,251,255,255,255,255,255,255,255,255,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,160,255,255,255,255,255,255,255,255,255,251,128,160,  0,
-      0,  0,  0,  0,  0,  0,  0,128,128,128,128,128,128,128,128,128,128,213,255,213,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,251,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,192,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,128,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,255,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,213,  0,
-      0,  0,  0,  0,  0,160,213,213,213,213,213,213,213,213,213,128,192,213,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,213,  0,  0,  0,  0,
-      0,  0,  0,128,192,255,255,255,255,255,255,255,255,255,255,160,  0,  0,  0,  0,
-      0,128,251,251,128,160,192,192,192,192,192,192,192,192,128,  0,  0,  0,  0,  0,
-      0,213,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-    160,255,192,128,192,192,192,192,192,192,192,192,192,  0,  0,  0,  0,  0,  0,  0,
-      0,128,128,251,255,255,255,255,255,255,255,255,255,213,  0,  0,  0,  0,  0,  0,
-      0,  0,192,255,255,255,255,255,255,255,255,255,255,251,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,192,251,251,251,251,251,251,251,251,192,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,128,251,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,  0,  0,  0,251,255,255,255,255,255,255,255,255,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,160,255,255,255,255,255,255,255,255,255,251,128,160,  0,
-      0,  0,  0,  0,  0,  0,  0,128,128,128,128,128,128,128,128,128,128,213,255,213,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,251,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,192,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,128,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,255,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,213,  0,
-      0,  0,  0,  0,  0,160,213,213,213,213,213,213,213,213,213,128,192,213,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,213,  0,  0,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,160,128,  0,  0,  0,
-      0,  0,  0,  0,  0,160,192,192,192,192,192,192,192,192,128,160,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-      0,  0,  0,128,192,192,192,192,192,192,192,192,192,  0,213,251,128,  0,  0,  0,
-      0,  0,128,251,255,255,255,255,255,255,255,255,255,213,  0,128,  0,  0,  0,  0,
-      0,  0,192,255,255,255,255,255,255,255,255,255,255,251,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,192,251,251,251,251,251,251,251,251,192,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,128,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,  0,
-      0,  0,  0,160,255,251,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,213,
-      0,  0,  0,255,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,
-      0,  0,128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,251,
-      0,  0,128,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,
-      0,  0,160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,192,
-      0,  0,192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,
-      0,  0,213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,128,
-      0,  0,251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,
-      0,  0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,255,  0,
-      0,  0,251,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,213,  0,
-      0,  0,128,251,128,160,213,213,213,213,213,213,213,213,213,128,192,213,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,213,  0,  0,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,160,128,  0,  0,  0,
-      0,  0,  0,  0,  0,160,192,192,192,192,192,192,192,192,128,160,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,251,128,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,128,251,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,  0,  0,  0,251,255,255,255,255,255,255,255,255,255,255,213,  0,  0,
-      0,  0,  0,  0,128,128,160,255,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,160,255,251,128,128,128,128,128,128,128,128,128,128,  0,  0,  0,  0,
-      0,  0,  0,255,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,128,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,251,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,128,251,128,160,213,213,213,213,213,213,213,213,213,128,  0,  0,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,213,  0,  0,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,160,128,  0,  0,  0,
-      0,  0,  0,  0,  0,160,192,192,192,192,192,192,192,192,128,160,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-      0,  0,  0,128,192,192,192,192,192,192,192,192,192,  0,213,251,128,  0,  0,  0,
-      0,  0,128,251,255,255,255,255,255,255,255,255,255,213,  0,128,  0,  0,  0,  0,
-      0,  0,192,255,255,255,255,255,255,255,255,255,255,251,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,192,251,251,251,251,251,251,251,251,192,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,128,251,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,  0,  0,  0,251,255,255,255,255,255,255,255,255,255,255,213,  0,  0,
-      0,  0,  0,  0,128,128,160,255,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,160,255,251,128,128,128,128,128,128,128,128,128,128,  0,  0,  0,  0,
-      0,  0,  0,255,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,128,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,251,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,128,251,128,160,213,213,213,213,213,213,213,213,213,128,  0,  0,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,213,  0,  0,  0,  0,
-      0,  0,  0,128,192,255,255,255,255,255,255,255,255,255,255,160,128,  0,  0,  0,
-      0,128,251,251,128,160,192,192,192,192,192,192,192,192,128,160,255,192,  0,  0,
-      0,213,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-    128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-    128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-    160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-    192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-    213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-    251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-    251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-    160,255,192,128,192,192,192,192,192,192,192,192,192,  0,213,251,128,  0,  0,  0,
-      0,128,128,251,255,255,255,255,255,255,255,255,255,213,  0,128,  0,  0,  0,  0,
-      0,  0,192,255,255,255,255,255,255,255,255,255,255,251,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,192,251,251,251,251,251,251,251,251,192,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,128,251,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,  0,  0,  0,251,255,255,255,255,255,255,255,255,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,160,255,255,255,255,255,255,255,255,255,251,128,160,  0,
-      0,  0,  0,  0,  0,  0,  0,128,128,128,128,128,128,128,128,128,128,213,255,213,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,251,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,192,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,128,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,255,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,213,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,251,128,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,128,251,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,  0,  0,  0,251,255,255,255,255,255,255,255,255,255,255,213,  0,  0,
-      0,  0,  0,  0,128,128,160,255,255,255,255,255,255,255,255,255,251,128,160,  0,
-      0,  0,  0,160,255,251,128,128,128,128,128,128,128,128,128,128,128,213,255,213,
-      0,  0,  0,255,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,
-      0,  0,128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,251,
-      0,  0,128,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,
-      0,  0,160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,192,
-      0,  0,192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,
-      0,  0,213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,128,
-      0,  0,251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,
-      0,  0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,255,  0,
-      0,  0,251,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,213,  0,
-      0,  0,128,251,128,160,213,213,213,213,213,213,213,213,213,128,192,213,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,213,  0,  0,  0,  0,
-      0,  0,  0,128,192,255,255,255,255,255,255,255,255,255,255,160,128,  0,  0,  0,
-      0,128,251,251,128,160,192,192,192,192,192,192,192,192,128,160,255,192,  0,  0,
-      0,213,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-    128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-    128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-    160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-    192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-    213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-    251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-    251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-    160,255,192,128,192,192,192,192,192,192,192,192,192,  0,213,251,128,  0,  0,  0,
-      0,128,128,251,255,255,255,255,255,255,255,255,255,213,  0,128,  0,  0,  0,  0,
-      0,  0,192,255,255,255,255,255,255,255,255,255,255,251,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,192,251,251,251,251,251,251,251,251,192,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,128,251,255,255,255,255,255,255,255,255,251,128,  0,  0,
-      0,  0,  0,  0,  0,  0,251,255,255,255,255,255,255,255,255,255,255,213,  0,  0,
-      0,  0,  0,  0,128,128,160,255,255,255,255,255,255,255,255,255,251,128,160,  0,
-      0,  0,  0,160,255,251,128,128,128,128,128,128,128,128,128,128,128,213,255,213,
-      0,  0,  0,255,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,
-      0,  0,128,255,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,251,
-      0,  0,128,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,
-      0,  0,160,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,192,
-      0,  0,192,255,255,251,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,
-      0,  0,213,255,255,213,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,128,
-      0,  0,251,255,255,192,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,
-      0,  0,251,255,255,160,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,255,  0,
-      0,  0,251,255,255,128,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,213,  0,
-      0,  0,128,251,128,160,213,213,213,213,213,213,213,213,213,128,192,213,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,213,  0,  0,  0,  0,
-      0,  0,  0,  0,192,255,255,255,255,255,255,255,255,255,255,160,128,  0,  0,  0,
-      0,  0,  0,  0,  0,160,192,192,192,192,192,192,192,192,128,160,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,160,255,255,251,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,192,255,255,213,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,213,255,255,192,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,251,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,160,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,128,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,128,255,255,255,  0,  0,  0,
-      0,  0,  0,128,192,192,192,192,192,192,192,192,192,  0,213,251,128,  0,  0,  0,
-      0,  0,128,251,255,255,255,255,255,255,255,255,255,213,  0,128,  0,  0,  0,  0,
-      0,  0,192,255,255,255,255,255,255,255,255,255,255,251,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,192,251,251,251,251,251,251,251,251,192,  0,  0,  0,  0,  0,  0,  0,
-
-      20, 30,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  1, 21, 21,  1,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 44, 99,140,140, 99, 44,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  1,124,229,255,255,229,124,  1,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 23,194,255,255,255,255,194, 23,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 48,215,255,255,255,255,215, 48,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  5,174,255,255,255,255,174,  5,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 91,188,251,251,188, 91,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  5, 49, 49,  5,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  1, 21, 21,  1,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 44, 99,140,140, 99, 44,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  1,124,229,255,255,229,124,  1,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 23,194,255,255,255,255,194, 23,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 48,215,255,255,255,255,215, 48,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  5,174,255,255,255,255,174,  5,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 91,188,251,251,188, 91,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  5, 49, 49,  5,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-
+    // [0]
+      0, 20, 30,  5,193,128,251,135,193,251,128,  7,192,251,137,192,213,  5,194,128,128,160,136,194,
+    251,128,160,  3,208,160,255,251,128,128,128,128,128,128,128,128,128,128,128,213,255,213,  2,130,
+    192,160,  8,192,160,129,192,251,  1,192,128,130,192,128,  8,192,192,129,192,251,  1,192,128,130,
+      9,192,192,129,192,213,  1,192,160,129,192,251,  9,192,251,129,192,192,  1,192,192,129,192,251,
+      9,192,251,129,192,160,  1,192,213,129,192,213,  9,130,192,128,  1,192,251,129,192,192,  8,192,
+    128,130,192,128,  1,192,251,129,192,160,  8,192,160,130,  2,192,251,129,192,128,  8,192,160,129,
+    192,213,  2,194,128,251,128, 10,193,192,213, 24,192,128, 11,192,128,  3,195,128,251,251,128,  9,
+    194,160,255,192,  2,192,213,129,192,192,  8,192,128,130,192,128,  1,192,251,129,192,160,  8,192,
+    128,130,  1,192,128,130,192,128,  8,192,160,129,192,251,  1,192,128,130,192,128,  8,192,192,129,
+    192,213,  1,192,160,129,192,251,  9,192,213,129,192,192,  1,192,192,129,192,251,  9,192,251,129,
+    192,160,  1,192,213,129,192,213,  9,130,192,160,  1,192,251,129,192,192,  8,192,128,130,192,128,
+      1,192,251,129,192,160,  8,192,128,130,  2,208,160,255,192,128,192,192,192,192,192,192,192,192,
+    192,  0,213,251,128,  3,194,128,128,251,136,194,213,  0,128,  5,192,192,137,192,251,  8,201,192,
+    251,251,251,251,251,251,251,251,192,  6,
+    // [1]
+      0, 20, 30, 57,192,160, 17,194,213,255,213, 15,192,160,129,192,251, 15,192,192,129,192,251, 15,
+    192,192,129,192,213, 15,192,251,129,192,192, 15,192,251,129,192,160, 15,130,192,128, 14,192,128,
+    130,192,128, 14,192,160,130, 15,192,160,129,192,213, 16,193,192,213, 37,192,128, 17,194,160,255,
+    192, 15,192,128,130,192,128, 14,192,128,130, 15,192,160,129,192,251, 15,192,192,129,192,213, 15,
+    192,213,129,192,192, 15,192,251,129,192,160, 15,130,192,160, 14,192,128,130,192,128, 14,192,128,
+    130, 16,194,213,251,128, 17,192,128, 43,
+    // [2]
+      0, 20, 30,  5,193,128,251,135,193,251,128,  7,192,251,137,192,213,  7,192,160,136,194,251,128,
+    160,  7,204,128,128,128,128,128,128,128,128,128,128,213,255,213, 15,192,160,129,192,251, 15,192,
+    192,129,192,251, 15,192,192,129,192,213, 15,192,251,129,192,192, 15,192,251,129,192,160, 15,130,
+    192,128, 14,192,128,130,192,128, 14,192,160,130, 15,192,160,129,192,213,  5,204,160,213,213,213,
+    213,213,213,213,213,213,128,192,213,  5,192,192,137,192,213,  6,193,128,192,137,192,160,  4,205,
+    128,251,251,128,160,192,192,192,192,192,192,192,192,128,  5,192,213,129,192,192, 15,192,251,129,
+    192,160, 14,192,128,130,192,128, 14,192,128,130,192,128, 14,192,160,129,192,251, 15,192,192,129,
+    192,251, 15,192,213,129,192,213, 15,192,251,129,192,192, 15,192,251,129,192,160, 15,204,160,255,
+    192,128,192,192,192,192,192,192,192,192,192,  7,194,128,128,251,136,192,213,  7,192,192,137,192,
+    251,  8,201,192,251,251,251,251,251,251,251,251,192,  6,
+    // [3]
+      0, 20, 30,  5,193,128,251,135,193,251,128,  7,192,251,137,192,213,  7,192,160,136,194,251,128,
+    160,  7,204,128,128,128,128,128,128,128,128,128,128,213,255,213, 15,192,160,129,192,251, 15,192,
+    192,129,192,251, 15,192,192,129,192,213, 15,192,251,129,192,192, 15,192,251,129,192,160, 15,130,
+    192,128, 14,192,128,130,192,128, 14,192,160,130, 15,192,160,129,192,213,  5,204,160,213,213,213,
+    213,213,213,213,213,213,128,192,213,  5,192,192,137,192,213,  7,192,192,137,193,160,128,  7,204,
+    160,192,192,192,192,192,192,192,192,128,160,255,192, 15,192,128,130,192,128, 14,192,128,130, 15,
+    192,160,129,192,251, 15,192,192,129,192,213, 15,192,213,129,192,192, 15,192,251,129,192,160, 15,
+    130,192,160, 14,192,128,130,192,128, 14,192,128,130,  5,205,128,192,192,192,192,192,192,192,192,
+    192,  0,213,251,128,  4,193,128,251,136,194,213,  0,128,  5,192,192,137,192,251,  8,201,192,251,
+    251,251,251,251,251,251,251,192,  6,
+    // [4]
+      0, 20, 30, 43,193,128,128, 11,192,160,  3,195,160,255,251,128,  9,194,213,255,213,  2,130,192,
+    160,  8,192,160,129,192,251,  1,192,128,130,192,128,  8,192,192,129,192,251,  1,192,128,130,  9,
+    192,192,129,192,213,  1,192,160,129,192,251,  9,192,251,129,192,192,  1,192,192,129,192,251,  9,
+    192,251,129,192,160,  1,192,213,129,192,213,  9,130,192,128,  1,192,251,129,192,192,  8,192,128,
+    130,192,128,  1,192,251,129,192,160,  8,192,160,130,  2,192,251,129,192,128,  8,192,160,129,192,
+    213,  2,207,128,251,128,160,213,213,213,213,213,213,213,213,213,128,192,213,  5,192,192,137,192,
+    213,  7,192,192,137,193,160,128,  7,204,160,192,192,192,192,192,192,192,192,128,160,255,192, 15,
+    192,128,130,192,128, 14,192,128,130, 15,192,160,129,192,251, 15,192,192,129,192,213, 15,192,213,
+    129,192,192, 15,192,251,129,192,160, 15,130,192,160, 14,192,128,130,192,128, 14,192,128,130, 16,
+    194,213,251,128, 17,192,128, 43,
+    // [5]
+      0, 20, 30,  5,193,128,251,135,193,251,128,  7,192,251,137,192,213,  5,194,128,128,160,136,193,
+    251,128,  4,204,160,255,251,128,128,128,128,128,128,128,128,128,128,  6,130,192,160, 14,192,128,
+    130,192,128, 14,192,128,130, 15,192,160,129,192,251, 15,192,192,129,192,251, 15,192,213,129,192,
+    213, 15,192,251,129,192,192, 15,192,251,129,192,160, 15,192,251,129,192,128, 15,205,128,251,128,
+    160,213,213,213,213,213,213,213,213,213,128,  7,192,192,137,192,213,  7,192,192,137,193,160,128,
+      7,204,160,192,192,192,192,192,192,192,192,128,160,255,192, 15,192,128,130,192,128, 14,192,128,
+    130, 15,192,160,129,192,251, 15,192,192,129,192,213, 15,192,213,129,192,192, 15,192,251,129,192,
+    160, 15,130,192,160, 14,192,128,130,192,128, 14,192,128,130,  5,205,128,192,192,192,192,192,192,
+    192,192,192,  0,213,251,128,  4,193,128,251,136,194,213,  0,128,  5,192,192,137,192,251,  8,201,
+    192,251,251,251,251,251,251,251,251,192,  6,
+    // [6]
+      0, 20, 30,  5,193,128,251,135,193,251,128,  7,192,251,137,192,213,  5,194,128,128,160,136,193,
+    251,128,  4,204,160,255,251,128,128,128,128,128,128,128,128,128,128,  6,130,192,160, 14,192,128,
+    130,192,128, 14,192,128,130, 15,192,160,129,192,251, 15,192,192,129,192,251, 15,192,213,129,192,
+    213, 15,192,251,129,192,192, 15,192,251,129,192,160, 15,192,251,129,192,128, 15,205,128,251,128,
+    160,213,213,213,213,213,213,213,213,213,128,  7,192,192,137,192,213,  6,193,128,192,137,193,160,
+    128,  3,208,128,251,251,128,160,192,192,192,192,192,192,192,192,128,160,255,192,  2,192,213,129,
+    192,192,  8,192,128,130,192,128,  1,192,251,129,192,160,  8,192,128,130,  1,192,128,130,192,128,
+      8,192,160,129,192,251,  1,192,128,130,192,128,  8,192,192,129,192,213,  1,192,160,129,192,251,
+      9,192,213,129,192,192,  1,192,192,129,192,251,  9,192,251,129,192,160,  1,192,213,129,192,213,
+      9,130,192,160,  1,192,251,129,192,192,  8,192,128,130,192,128,  1,192,251,129,192,160,  8,192,
+    128,130,  2,208,160,255,192,128,192,192,192,192,192,192,192,192,192,  0,213,251,128,  3,194,128,
+    128,251,136,194,213,  0,128,  5,192,192,137,192,251,  8,201,192,251,251,251,251,251,251,251,251,
+    192,  6,
+    // [7]
+      0, 20, 30,  5,193,128,251,135,193,251,128,  7,192,251,137,192,213,  7,192,160,136,194,251,128,
+    160,  7,204,128,128,128,128,128,128,128,128,128,128,213,255,213, 15,192,160,129,192,251, 15,192,
+    192,129,192,251, 15,192,192,129,192,213, 15,192,251,129,192,192, 15,192,251,129,192,160, 15,130,
+    192,128, 14,192,128,130,192,128, 14,192,160,130, 15,192,160,129,192,213, 16,193,192,213, 37,192,
+    128, 17,194,160,255,192, 15,192,128,130,192,128, 14,192,128,130, 15,192,160,129,192,251, 15,192,
+    192,129,192,213, 15,192,213,129,192,192, 15,192,251,129,192,160, 15,130,192,160, 14,192,128,130,
+    192,128, 14,192,128,130, 16,194,213,251,128, 17,192,128, 43,
+    // [8]
+      0, 20, 30,  5,193,128,251,135,193,251,128,  7,192,251,137,192,213,  5,194,128,128,160,136,194,
+    251,128,160,  3,208,160,255,251,128,128,128,128,128,128,128,128,128,128,128,213,255,213,  2,130,
+    192,160,  8,192,160,129,192,251,  1,192,128,130,192,128,  8,192,192,129,192,251,  1,192,128,130,
+      9,192,192,129,192,213,  1,192,160,129,192,251,  9,192,251,129,192,192,  1,192,192,129,192,251,
+      9,192,251,129,192,160,  1,192,213,129,192,213,  9,130,192,128,  1,192,251,129,192,192,  8,192,
+    128,130,192,128,  1,192,251,129,192,160,  8,192,160,130,  2,192,251,129,192,128,  8,192,160,129,
+    192,213,  2,207,128,251,128,160,213,213,213,213,213,213,213,213,213,128,192,213,  5,192,192,137,
+    192,213,  6,193,128,192,137,193,160,128,  3,208,128,251,251,128,160,192,192,192,192,192,192,192,
+    192,128,160,255,192,  2,192,213,129,192,192,  8,192,128,130,192,128,  1,192,251,129,192,160,  8,
+    192,128,130,  1,192,128,130,192,128,  8,192,160,129,192,251,  1,192,128,130,192,128,  8,192,192,
+    129,192,213,  1,192,160,129,192,251,  9,192,213,129,192,192,  1,192,192,129,192,251,  9,192,251,
+    129,192,160,  1,192,213,129,192,213,  9,130,192,160,  1,192,251,129,192,192,  8,192,128,130,192,
+    128,  1,192,251,129,192,160,  8,192,128,130,  2,208,160,255,192,128,192,192,192,192,192,192,192,
+    192,192,  0,213,251,128,  3,194,128,128,251,136,194,213,  0,128,  5,192,192,137,192,251,  8,201,
+    192,251,251,251,251,251,251,251,251,192,  6,
+    // [9]
+      0, 20, 30,  5,193,128,251,135,193,251,128,  7,192,251,137,192,213,  5,194,128,128,160,136,194,
+    251,128,160,  3,208,160,255,251,128,128,128,128,128,128,128,128,128,128,128,213,255,213,  2,130,
+    192,160,  8,192,160,129,192,251,  1,192,128,130,192,128,  8,192,192,129,192,251,  1,192,128,130,
+      9,192,192,129,192,213,  1,192,160,129,192,251,  9,192,251,129,192,192,  1,192,192,129,192,251,
+      9,192,251,129,192,160,  1,192,213,129,192,213,  9,130,192,128,  1,192,251,129,192,192,  8,192,
+    128,130,192,128,  1,192,251,129,192,160,  8,192,160,130,  2,192,251,129,192,128,  8,192,160,129,
+    192,213,  2,207,128,251,128,160,213,213,213,213,213,213,213,213,213,128,192,213,  5,192,192,137,
+    192,213,  7,192,192,137,193,160,128,  7,204,160,192,192,192,192,192,192,192,192,128,160,255,192,
+     15,192,128,130,192,128, 14,192,128,130, 15,192,160,129,192,251, 15,192,192,129,192,213, 15,192,
+    213,129,192,192, 15,192,251,129,192,160, 15,130,192,160, 14,192,128,130,192,128, 14,192,128,130,
+      5,205,128,192,192,192,192,192,192,192,192,192,  0,213,251,128,  4,193,128,251,136,194,213,  0,
+    128,  5,192,192,137,192,251,  8,201,192,251,251,251,251,251,251,251,251,192,  6,
+    // [10]
+      0, 20, 30, 88,195,  1, 21, 21,  1, 14,197, 44, 99,140,140, 99, 44, 12,194,  1,124,229,129,194,
+    229,124,  1, 11,193, 23,194,131,193,194, 23, 11,193, 48,215,131,193,215, 48, 11,193,  5,174,131,
+    193,174,  5, 12,197, 91,188,251,251,188, 91, 14,195,  5, 49, 49,  5,127,  7,195,  1, 21, 21,  1,
+     14,197, 44, 99,140,140, 99, 44, 12,194,  1,124,229,129,194,229,124,  1, 11,193, 23,194,131,193,
+    194, 23, 11,193, 48,215,131,193,215, 48, 11,193,  5,174,131,193,174,  5, 12,197, 91,188,251,251,
+    188, 91, 14,195,  5, 49, 49,  5, 86,
 };
+const uint16_t SSEG_DIGITS_OFFSET[] = {0, 322, 452, 682, 907, 1131, 1358, 1648, 1807, 2154, 2438};
+// 2567 bytes (raw 6622 bytes)
+
@@ -1,4 +1,5 @@
 #include <SD.h>
+#include <W25Q64.h>
 #include "display.h"
 
 // -----------------------------------------------------------------------------
@@ -10,76 +11,1050 @@ AlphaBrender& AlphaBrend()
     return _brender;
 }
 
+#ifdef HX8357_STATS
+// -----------------------------------------------------------------------------
+//  createImage() の表を引く経路(TABLE_THRESHOLD 以上)が、全アルファ値について
+//  alphaBlendRGB565() と同じ結果になることを確かめる(違っていた画素数を返す)
+//  奇数の大きさ(最後の１画素を別に処理する)と偶数の大きさの両方を試す
+// -----------------------------------------------------------------------------
+uint32_t AlphaBrender::selfTest()
+{
+    static const uint16_t colors[][2] = {
+        {COLOR_WHITE, COLOR_BLACK}, {COLOR_BLACK, COLOR_WHITE}, {0xF800, 0x07E0}, {0x001F, 0xFFE0},
+        {0x8410, 0x4208}, {0x07FF, 0xF81F}, {0x1234, 0xFEDC}, {0xFFFF, 0xFFFF}
+    };
+    uint8_t source[257];
+    uint16_t buffer[257];
+    uint32_t errors = 0;
+    for( uint16_t c = 0 ; c < sizeof(colors) / sizeof(colors[0]) ; c++ )
+    {
+        uint16_t fgcol = colors[c][0];
+        uint16_t bkcol = colors[c][1];
+        for( int16_t size = 256 ; size <= 257 ; size++ )
+        {
+            for( int16_t i = 0 ; i < size ; i++ )
+            {
+                source[i] = (uint8_t)(i + size);   // 大きさごとにずらし、偶数・奇数の両方の位置で試す
+            }
+            AlphaBrend().createImage(buffer, source, size, fgcol, bkcol);
+            for( int16_t i = 0 ; i < size ; i++ )
+            {
+                uint16_t expected = AlphaBrender::alphaBlendRGB565(fgcol, bkcol, source[i]);
+                if( buffer[i] != expected )
+                {
+                    if( errors < 8 )
+                    {
+                        Serial.printf("AlphaBrender: fg=%04X bg=%04X alpha=%d : %04X != %04X\n",
+                            fgcol, bkcol, source[i], buffer[i], expected);
+                    }
+                    errors++;
+                }
+            }
+        }
+    }
+    Serial.printf("AlphaBrender self test : %d errors\n", errors);
+    return errors;
+}
+#endif
+
+// -----------------------------------------------------------------------------
+//  BlendCache
+// -----------------------------------------------------------------------------
+#ifdef BLEND_CACHE_EXTMEM
+#define CACHE_MALLOC(n) extmem_malloc(n)
+#define CACHE_FREE(p)   extmem_free(p)
+#else
+#define CACHE_MALLOC(n) malloc(n)
+#define CACHE_FREE(p)   free(p)
+#endif
+
+BlendCache& GlyphCache()
+{
+    static BlendCache _cache(32*1024);
+    return _cache;
+}
+
+BlendCache& IconCache()
+{
+    static BlendCache _cache(ICON_CACHE_BYTES);
+    return _cache;
+}
+
+// -----------------------------------------------------------------------------
+BlendCache::BlendCache(uint32_t budget)
+    : m_head(nullptr), m_tail(nullptr), m_budget(budget), m_used(0), m_hits(0), m_misses(0)
+{
+    for( int i = 0 ; i < BlendCache::NUM_BUCKETS ; i++ )
+    {
+        this->m_buckets[i] = nullptr;
+    }
+}
+
+// -----------------------------------------------------------------------------
+uint32_t BlendCache::hash(const void *owner, uint32_t id, uint16_t fgcol, uint16_t bkcol)
+{
+    uint32_t h = ((uint32_t)(uintptr_t)owner) ^ (id * 2654435761u);
+    h ^= h >> 9;
+    h ^= ((uint32_t)fgcol * 31) ^ ((uint32_t)bkcol * 131);
+    return h % BlendCache::NUM_BUCKETS;
+}
+
+// -----------------------------------------------------------------------------
+//  合成済みの画像をキャッシュから探す(なければ nullptr を返し、登録もしない)
+//  返した画像は次に get() を呼ぶまで有効
+// -----------------------------------------------------------------------------
+const uint16_t *BlendCache::find(const void *owner, uint32_t id, uint32_t size, uint16_t fgcol, uint16_t bkcol)
+{
+    uint32_t n = BlendCache::hash(owner, id, fgcol, bkcol);
+    for( Entry *e = this->m_buckets[n] ; e ; e = e->chain )
+    {
+        if( (e->owner == owner) && (e->id == id) && (e->fgcol == fgcol) && (e->bkcol == bkcol) && (e->size == size) )
+        {
+            this->m_hits++;
+            if( e != this->m_head )
+            {
+                this->unlink(e);
+                e->prev = nullptr;
+                e->next = this->m_head;
+                this->m_head->prev = e;
+                this->m_head = e;
+            }
+            return e->pixels;
+        }
+    }
+    return nullptr;
+}
+
+// -----------------------------------------------------------------------------
+//  合成済みの画像を得る(キャッシュになければ合成して登録する)
+//  上限より大きい画像やメモリが確保できない場合は nullptr を返す
+//  返した画像は次に get() を呼ぶまで有効
+//  キーは (owner, id) なので、source はヒットしたときには読まない
+//  (ファイルから読み込んだグリフのように、バッファが使い回される場合に備える)
+// -----------------------------------------------------------------------------
+const uint16_t *BlendCache::get(const void *owner, uint32_t id, const uint8_t *source, uint32_t size, uint16_t fgcol, uint16_t bkcol, uint8_t bits)
+{
+    const uint16_t *pixels = this->find(owner, id, size, fgcol, bkcol);
+    if( pixels )
+    {
+        return pixels;
+    }
+
+    this->m_misses++;
+    uint32_t n = BlendCache::hash(owner, id, fgcol, bkcol);
+    uint32_t bytes = BlendCache::entryBytes(size);
+    if( bytes > this->m_budget )
+    {
+        return nullptr;
+    }
+    while( this->m_used + bytes > this->m_budget )
+    {
+        this->remove(this->m_tail);
+    }
+    Entry *e = (Entry *)CACHE_MALLOC(bytes);
+    if( e == nullptr )
+    {
+        return nullptr;
+    }
+    e->owner = owner;
+    e->id = id;
+    e->fgcol = fgcol;
+    e->bkcol = bkcol;
+    e->size = size;
+    if( bits == 8 )
+    {
+        AlphaBrend().createImage(e->pixels, source, size, fgcol, bkcol);
+    }
+    else if( bits == BlendCache::RUN_LENGTH )
+    {
+        AlphaBrend().createRunLengthImage(e->pixels, source, size, fgcol, bkcol);
+    }
+    else
+    {
+        AlphaBrend().createPackedImage(e->pixels, source, size, bits, fgcol, bkcol);
+    }
+
+    e->chain = this->m_buckets[n];
+    this->m_buckets[n] = e;
+    e->prev = nullptr;
+    e->next = this->m_head;
+    if( this->m_head )
+    {
+        this->m_head->prev = e;
+    }
+    else
+    {
+        this->m_tail = e;
+    }
+    this->m_head = e;
+    this->m_used += bytes;
+    return e->pixels;
+}
+
+// -----------------------------------------------------------------------------
+//  LRU リストから外す
+// -----------------------------------------------------------------------------
+void BlendCache::unlink(Entry *e)
+{
+    if( e->prev )
+    {
+        e->prev->next = e->next;
+    }
+    else
+    {
+        this->m_head = e->next;
+    }
+    if( e->next )
+    {
+        e->next->prev = e->prev;
+    }
+    else
+    {
+        this->m_tail = e->prev;
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  エントリを捨てる
+// -----------------------------------------------------------------------------
+void BlendCache::remove(Entry *e)
+{
+    this->unlink(e);
+    Entry **p = &this->m_buckets[BlendCache::hash(e->owner, e->id, e->fgcol, e->bkcol)];
+    while( *p != e )
+    {
+        p = &(*p)->chain;
+    }
+    *p = e->chain;
+    this->m_used -= BlendCache::entryBytes(e->size);
+    CACHE_FREE(e);
+}
+
+// -----------------------------------------------------------------------------
+void BlendCache::setBudget(uint32_t budget)
+{
+    this->m_budget = budget;
+    while( this->m_used > this->m_budget )
+    {
+        this->remove(this->m_tail);
+    }
+}
+
+// -----------------------------------------------------------------------------
+void BlendCache::clear()
+{
+    while( this->m_tail )
+    {
+        this->remove(this->m_tail);
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  Surface
+// -----------------------------------------------------------------------------
+uint16_t *Surface::getScratch()
+{
+    static uint16_t _scratch[Surface::SCRATCH_PIXELS];
+    return _scratch;
+}
+
+// -----------------------------------------------------------------------------
+//  描き込む範囲を rc に制限する(サーフェスの外にははみ出さない)
+// -----------------------------------------------------------------------------
+void Surface::setClip(Rect rc)
+{
+    int16_t x0 = max(rc.left, this->m_rc.left);
+    int16_t y0 = max(rc.top, this->m_rc.top);
+    int16_t x1 = min((int16_t)(rc.left+rc.width), (int16_t)(this->m_rc.left+this->m_rc.width));
+    int16_t y1 = min((int16_t)(rc.top+rc.height), (int16_t)(this->m_rc.top+this->m_rc.height));
+    this->m_clip = Rect(x0, y0, max((int16_t)(x1 - x0), (int16_t)0), max((int16_t)(y1 - y0), (int16_t)0));
+}
+
+// -----------------------------------------------------------------------------
+void Surface::fillRect(Rect rc, uint16_t color)
+{
+    int16_t x0 = max(rc.left, this->m_clip.left);
+    int16_t y0 = max(rc.top, this->m_clip.top);
+    int16_t x1 = min(rc.left+rc.width, this->m_clip.left+this->m_clip.width);
+    int16_t y1 = min(rc.top+rc.height, this->m_clip.top+this->m_clip.height);
+    for( int16_t y = y0 ; y < y1 ; y++ )
+    {
+        uint16_t *p = this->m_pixels + (y - this->m_rc.top) * this->m_rc.width + (x0 - this->m_rc.left);
+        for( int16_t x = x0 ; x < x1 ; x++ )
+        {
+            *p++ = color;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  w × h の画像を (x, y) に写す(クリップ範囲からはみ出す部分は捨てる)
+// -----------------------------------------------------------------------------
+void Surface::drawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *image)
+{
+    int16_t x0 = max(x, this->m_clip.left);
+    int16_t y0 = max(y, this->m_clip.top);
+    int16_t x1 = min((int16_t)(x+w), (int16_t)(this->m_clip.left+this->m_clip.width));
+    int16_t y1 = min((int16_t)(y+h), (int16_t)(this->m_clip.top+this->m_clip.height));
+    if( (x0 >= x1) || (y0 >= y1) )
+    {
+        return;
+    }
+    for( int16_t row = y0 ; row < y1 ; row++ )
+    {
+        memcpy(this->m_pixels + (row - this->m_rc.top) * this->m_rc.width + (x0 - this->m_rc.left),
+            image + (row - y) * w + (x0 - x), (x1 - x0) * sizeof(uint16_t));
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  FontFile
+// -----------------------------------------------------------------------------
+SDFontFile::SDFontFile(const char *path)
+{
+    this->m_file = SD.open(path);
+}
+
+SDFontFile::~SDFontFile()
+{
+    if( this->m_file )
+    {
+        this->m_file.close();
+    }
+}
+
+bool SDFontFile::read(uint32_t pos, void *buffer, uint32_t len)
+{
+    if( !this->m_file || !this->m_file.seek(pos) )
+    {
+        return false;
+    }
+    return this->m_file.read(buffer, len) == (int)len;
+}
+
+// -----------------------------------------------------------------------------
+//  目録の index 番目のファイルを開く(目録になければ何も読めない)
+// -----------------------------------------------------------------------------
+FlashFontFile::FlashFontFile(uint8_t index) : m_base(0), m_size(0)
+{
+    Directory dir;
+    if( FlashFontFile::readDirectory(&dir) && (index < dir.count) )
+    {
+        this->m_base = dir.entries[index].sector * FlashFontFile::SECTOR_SIZE;
+        this->m_size = dir.entries[index].size;
+    }
+}
+
+// -----------------------------------------------------------------------------
+bool FlashFontFile::read(uint32_t pos, void *buffer, uint32_t len)
+{
+    if( (pos > this->m_size) || (len > this->m_size - pos) )
+    {
+        return false;
+    }
+    uint8_t *p = (uint8_t *)buffer;
+    uint32_t addr = this->m_base + pos;
+    while( len > 0 )
+    {
+        uint16_t n = (uint16_t)min(len, (uint32_t)FlashFontFile::CHUNK_SIZE);
+        W25Q64_read(addr, p, n);
+        p    += n;
+        addr += n;
+        len  -= n;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+//  目録を読み込む(書き込まれていないか壊れていれば false)
+// -----------------------------------------------------------------------------
+bool FlashFontFile::readDirectory(Directory *dir)
+{
+    W25Q64_read((uint32_t)FlashFontFile::FIRST_SECTOR * FlashFontFile::SECTOR_SIZE, (uint8_t *)dir, sizeof(Directory));
+    if( (dir->magic != FlashFontFile::DIRECTORY_MAGIC) || (dir->count > FlashFontFile::MAX_FILES) )
+    {
+        return false;
+    }
+    for( uint32_t n = 0 ; n < dir->count ; n++ )
+    {
+        const Entry &e = dir->entries[n];
+        uint32_t sectors = (e.size + FlashFontFile::SECTOR_SIZE - 1) / FlashFontFile::SECTOR_SIZE;
+        if( (e.sector <= FlashFontFile::FIRST_SECTOR) || (e.sector + sectors > FlashFontFile::END_SECTOR) )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+//  CRC-32(zlib.crc32 と同じ値、crc に前回の値を渡すと続きを計算する)
+// -----------------------------------------------------------------------------
+static uint32_t crc32(uint32_t crc, const void *data, uint32_t len)
+{
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C
+    };
+    const uint8_t *p = (const uint8_t *)data;
+    uint32_t c = ~crc;
+    while( len-- )
+    {
+        c = table[(c ^ *p) & 0x0F] ^ (c >> 4);
+        c = table[(c ^ (*p++ >> 4)) & 0x0F] ^ (c >> 4);
+    }
+    return ~c;
+}
+
+// -----------------------------------------------------------------------------
+//  SD カード上のファイルのサイズと CRC-32 を求める
+// -----------------------------------------------------------------------------
+bool FlashFontFile::inspect(const char *path, uint32_t *size, uint32_t *crc)
+{
+    File f = SD.open(path);
+    if( !f )
+    {
+        return false;
+    }
+    uint8_t buffer[512];
+    uint32_t c = 0;
+    int n;
+    while( (n = f.read(buffer, sizeof(buffer))) > 0 )
+    {
+        c = crc32(c, buffer, n);
+    }
+    *size = f.size();
+    *crc = c;
+    f.close();
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+//  SD カード上のファイルを書き込む
+//  目録のサイズと CRC が SD カード上のファイルと一致していれば何もしない
+//  (SD カードにファイルがなければ、書き込み済みの内容をそのまま使う)
+//  どれかが違っていれば、ファイルのサイズに合わせて配置し直してすべて書き込む
+//  END_SECTOR に収まらない場合は書き込まずに false を返す
+// -----------------------------------------------------------------------------
+bool FlashFontFile::install(const char * const *paths, uint8_t count)
+{
+    if( count > FlashFontFile::MAX_FILES )
+    {
+        return false;
+    }
+    Directory current;
+    bool valid = FlashFontFile::readDirectory(&current) && (current.count == count);
+
+    Directory dir;
+    dir.magic = FlashFontFile::DIRECTORY_MAGIC;
+    dir.count = count;
+    uint32_t sector = FlashFontFile::FIRST_SECTOR + 1;
+    bool same = valid;
+    for( uint8_t n = 0 ; n < count ; n++ )
+    {
+        Entry &e = dir.entries[n];
+        if( !FlashFontFile::inspect(paths[n], &e.size, &e.crc) )
+        {
+            Serial.printf("%s not found\n", paths[n]);
+            return valid;
+        }
+        e.sector = sector;
+        sector += (e.size + FlashFontFile::SECTOR_SIZE - 1) / FlashFontFile::SECTOR_SIZE;
+        if( sector > FlashFontFile::END_SECTOR )
+        {
+            Serial.printf("%s : does not fit in flash (%lu bytes)\n", paths[n], (unsigned long)e.size);
+            return false;
+        }
+        if( valid && ((current.entries[n].size != e.size) || (current.entries[n].crc != e.crc)) )
+        {
+            same = false;
+        }
+    }
+    if( same )
+    {
+        return true;
+    }
+
+    // 書き込みの途中で電源が切れても古い目録が残らないよう、先に目録を消しておく
+    W25Q64_eraseSector(FlashFontFile::FIRST_SECTOR, true);
+    uint8_t buffer[256];
+    for( uint8_t n = 0 ; n < count ; n++ )
+    {
+        const Entry &e = dir.entries[n];
+        File f = SD.open(paths[n]);
+        if( !f )
+        {
+            return false;
+        }
+        for( uint32_t pos = 0 ; pos < e.size ; pos += 256 )
+        {
+            uint16_t sect_no = (uint16_t)(e.sector + pos / FlashFontFile::SECTOR_SIZE);
+            uint16_t offset = (uint16_t)(pos % FlashFontFile::SECTOR_SIZE);
+            if( offset == 0 )
+            {
+                W25Q64_eraseSector(sect_no, true);
+            }
+            memset(buffer, 0xFF, sizeof(buffer));
+            f.read(buffer, sizeof(buffer));
+            W25Q64_pageWrite(sect_no, offset, buffer, 256);
+        }
+        f.close();
+        Serial.printf("%s : %lu bytes written to flash (sector %lu)\n", paths[n], (unsigned long)e.size, (unsigned long)e.sector);
+    }
+    memset(buffer, 0xFF, sizeof(buffer));
+    memcpy(buffer, &dir, sizeof(dir));
+    W25Q64_pageWrite(FlashFontFile::FIRST_SECTOR, 0, buffer, 256);
+    return true;
+}
+
 // -----------------------------------------------------------------------------
 //  Font
 // -----------------------------------------------------------------------------
-Font::Font(uint8_t height, const uint32_t *data, const uint32_t *map)
-    : m_height(height), m_data(data), m_dataAA(nullptr), m_map(map), m_antialiased(false)
+Font::Font(uint8_t height, const uint32_t *data, const uint32_t *map)
+    : m_height(height), m_data(data), m_dataAA(nullptr), m_map(map), m_antialiased(false),
+    m_paged(map[0] == Font::MAP_MAGIC), m_bits(1), m_dataSize(0), m_signature(0),
+    m_file(nullptr), m_pages(nullptr), m_slots(nullptr), m_numSlots(0), m_useCount(0)
+{
+
+}
+
+// -----------------------------------------------------------------------------
+//  dataSize, mapWords はグリフデータのバイト数とマップデータの語数
+//  (0 の場合は読み込んだ GlyphRun のオフセットを確かめられないので、使わない)
+// -----------------------------------------------------------------------------
+Font::Font(uint8_t height, const uint8_t *data, const uint32_t *map, uint8_t bits, uint32_t dataSize, uint32_t mapWords)
+    : m_height(height), m_data(nullptr), m_dataAA(data), m_map(map), m_antialiased(true),
+    m_paged(map[0] == Font::MAP_MAGIC), m_bits(bits), m_dataSize(dataSize), m_signature(0),
+    m_file(nullptr), m_pages(nullptr), m_slots(nullptr), m_numSlots(0), m_useCount(0)
+{
+    Serial.print("offset of '0' : ");
+    Serial.println(this->getOffset('0'), HEX);
+    if( (dataSize > 0) && (mapWords > 0) && this->m_paged )
+    {
+        this->m_signature = crc32(this->signatureHeader(), map, mapWords * 4);
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  フォントファイルから読み込むアンチエイリアスフォント
+//  マップの上位表(257語)だけを RAM に置き、ページとグリフは必要なときに読む
+//  読んだグリフは numSlots 文字分をキャッシュする
+//  読み込みに失敗した場合は isLoaded() が false を返し、何も描画しない
+//  (ビット数が 2, 4, 8 以外のもの、１文字がステージングバッファに収まらないものも読み込まない)
+// -----------------------------------------------------------------------------
+Font::Font(FontFile *file, uint8_t numSlots)
+    : m_height(0), m_data(nullptr), m_dataAA(nullptr), m_map(nullptr), m_antialiased(true),
+    m_paged(true), m_bits(8), m_dataSize(0), m_signature(0),
+    m_file(file), m_pages(nullptr), m_slots(nullptr), m_numSlots(0), m_useCount(0)
+{
+    uint8_t header[FontFile::HEADER_SIZE];
+    if( !file->read(0, header, sizeof(header)) || (memcmp(header, "FNT1", 4) != 0) )
+    {
+        Serial.println("invalid font file");
+        return;
+    }
+    uint32_t mapWords, dataSize, glyphBytes;
+    memcpy(&mapWords, header+8, 4);
+    memcpy(&dataSize, header+12, 4);
+    memcpy(&glyphBytes, header+16, 4);
+    uint8_t bits = header[5];
+    if( (header[4] == 0) || ((bits != 2) && (bits != 4) && (bits != 8)) || (glyphBytes < 1) ||
+        (glyphBytes > 1 + ((uint32_t)HX8357::STAGING_PIXELS * bits + 7) / 8) )
+    {
+        Serial.printf("unsupported font file : height=%d bits=%d glyph bytes=%lu\n",
+            header[4], bits, (unsigned long)glyphBytes);
+        return;
+    }
+    this->m_height = header[4];
+    this->m_bits = header[5];
+    this->m_dataSize = dataSize;
+    this->m_glyphBytes = (uint16_t)glyphBytes;
+    this->m_dataPos = FontFile::HEADER_SIZE + mapWords * 4;
+
+    uint32_t *pages = (uint32_t *)malloc(257 * sizeof(uint32_t));
+    uint8_t *data = (uint8_t *)malloc(numSlots * glyphBytes);
+    CacheSlot *slots = (CacheSlot *)malloc(numSlots * sizeof(CacheSlot));
+    if( !pages || !data || !slots || !file->read(FontFile::HEADER_SIZE, pages, 257 * sizeof(uint32_t))
+        || (pages[0] != Font::MAP_MAGIC) )
+    {
+        Serial.println("failed to load font file");
+        free(pages);
+        free(data);
+        free(slots);
+        return;
+    }
+    for( uint8_t n = 0 ; n < numSlots ; n++ )
+    {
+        slots[n].code = 0;
+        slots[n].offset = Font::NOT_FOUND;
+        slots[n].lastUsed = 0;
+        slots[n].data = data + n * glyphBytes;
+    }
+    this->m_pages = pages;
+    this->m_slots = slots;
+    this->m_numSlots = numSlots;
+
+    // マップデータ全体からシグネチャを求める(読めなければ 0 のまま)
+    uint32_t crc = this->signatureHeader();
+    uint32_t words[64];
+    for( uint32_t pos = 0 ; pos < mapWords ; pos += 64 )
+    {
+        uint32_t n = min(mapWords - pos, (uint32_t)64);
+        if( !file->read(FontFile::HEADER_SIZE + pos * 4, words, n * 4) )
+        {
+            crc = 0;
+            break;
+        }
+        crc = crc32(crc, words, n * 4);
+    }
+    this->m_signature = crc;
+    Serial.printf("font file loaded : height=%d bits=%d\n", this->m_height, this->m_bits);
+}
+
+// -----------------------------------------------------------------------------
+//  ファイルから読み込んだ場合はファイルも閉じる
+// -----------------------------------------------------------------------------
+Font::~Font()
+{
+    if( this->m_slots )
+    {
+        free(this->m_slots[0].data);
+        free(this->m_slots);
+    }
+    free(this->m_pages);
+    delete this->m_file;
+}
+
+// -----------------------------------------------------------------------------
+//  マップデータの index 語目を得る
+// -----------------------------------------------------------------------------
+uint32_t Font::readMap(uint32_t index)
+{
+    if( this->m_map )
+    {
+        return this->m_map[index];
+    }
+    if( index < 257 )
+    {
+        return this->m_pages[index];
+    }
+    uint32_t value;
+    if( !this->m_file->read(FontFile::HEADER_SIZE + index * 4, &value, 4) )
+    {
+        return Font::NOT_FOUND;
+    }
+    return value;
+}
+
+// -----------------------------------------------------------------------------
+//  文字コードからグリフデータのオフセットを得る(ない場合は 0xFFFFFFFF)
+// -----------------------------------------------------------------------------
+uint32_t Font::getOffset(uint16_t code)
+{
+    if( !this->m_paged )
+    {
+        return this->m_map[code];
+    }
+    uint32_t page = this->readMap(1 + (code >> 8));
+    if( page == Font::NOT_FOUND )
+    {
+        return Font::NOT_FOUND;
+    }
+    uint32_t range = this->readMap(page);
+    uint8_t lo = (uint8_t)(code & 0xFF);
+    uint8_t first = (uint8_t)(range & 0xFF);
+    uint8_t last = (uint8_t)((range >> 8) & 0xFF);
+    if( (lo < first) || (last < lo) )
+    {
+        return Font::NOT_FOUND;
+    }
+    return this->readMap(page + 1 + (lo - first));
+}
+
+// -----------------------------------------------------------------------------
+//  幅 width のアンチエイリアスグリフのアルファデータのバイト数
+// -----------------------------------------------------------------------------
+uint32_t Font::getGlyphBytes(int16_t width)
+{
+    uint32_t size = width * this->m_height;
+    return (size * this->m_bits + 7) / 8;
+}
+
+// -----------------------------------------------------------------------------
+//  シグネチャの計算を文字高さ・ビット数・グリフデータのバイト数から始める
+//  (続けてマップデータ全体を加える、create_playdata.py の GlyphFont.signature と同じ)
+// -----------------------------------------------------------------------------
+uint32_t Font::signatureHeader()
+{
+    uint8_t header[6];
+    header[0] = this->m_height;
+    header[1] = this->m_bits;
+    memcpy(header+2, &this->m_dataSize, 4);
+    return crc32(0, header, sizeof(header));
+}
+
+// -----------------------------------------------------------------------------
+//  組み込みのアンチエイリアスフォントで、offset のグリフがデータの内側にあれば true
+//  (ファイルから読み込んだ GlyphRun のオフセットを信じる前に確かめる)
+// -----------------------------------------------------------------------------
+bool Font::isValidGlyph(uint32_t offset)
+{
+    if( this->m_dataSize == 0 )
+    {
+        return true;    // 大きさがわからない(shape() で作った GlyphRun しか使わない)
+    }
+    if( offset >= this->m_dataSize )
+    {
+        return false;
+    }
+    return 1 + this->getGlyphBytes(this->m_dataAA[offset]) <= this->m_dataSize - offset;
+}
+
+// -----------------------------------------------------------------------------
+//  アンチエイリアスグリフのデータ(幅 1byte に続いてアルファ値)を得る
+//  ない場合は nullptr を返す
+//  ファイルから読む場合、返したデータは次に getGlyph() を呼ぶまで有効
+//  (読めないグリフ、ステージングバッファに収まらないグリフはないものとして扱う)
+// -----------------------------------------------------------------------------
+const uint8_t *Font::getGlyph(uint16_t code, uint32_t *offset)
+{
+    if( !this->m_file )
+    {
+        *offset = this->m_map ? this->getOffset(code) : Font::NOT_FOUND;
+        return (*offset != Font::NOT_FOUND) ? this->m_dataAA + *offset : nullptr;
+    }
+    if( !this->m_slots )
+    {
+        *offset = Font::NOT_FOUND;
+        return nullptr;
+    }
+
+    this->m_useCount++;
+    CacheSlot *victim = &this->m_slots[0];
+    for( uint8_t n = 0 ; n < this->m_numSlots ; n++ )
+    {
+        CacheSlot *slot = &this->m_slots[n];
+        if( (slot->lastUsed != 0) && (slot->code == code) )
+        {
+            slot->lastUsed = this->m_useCount;
+            *offset = slot->offset;
+            return (slot->offset != Font::NOT_FOUND) ? slot->data : nullptr;
+        }
+        if( slot->lastUsed < victim->lastUsed )
+        {
+            victim = slot;
+        }
+    }
+
+    // 最も長く使っていないスロットに読み込む(ない文字も覚えておく)
+    victim->code = code;
+    victim->lastUsed = this->m_useCount;
+    victim->offset = this->getOffset(code);
+    *offset = victim->offset;
+    if( victim->offset == Font::NOT_FOUND )
+    {
+        return nullptr;
+    }
+    uint32_t pos = this->m_dataPos + victim->offset;
+    bool ok = this->m_file->read(pos, victim->data, 1);
+    uint32_t bytes = this->getGlyphBytes(victim->data[0]);
+    uint32_t pixels = (uint32_t)victim->data[0] * this->m_height;
+    if( ok && (bytes + 1 <= this->m_glyphBytes) && (pixels <= HX8357::STAGING_PIXELS) )
+    {
+        ok = this->m_file->read(pos + 1, victim->data + 1, bytes);
+    }
+    else
+    {
+        ok = false;
+    }
+    if( !ok )
+    {
+        victim->offset = Font::NOT_FOUND;
+        *offset = Font::NOT_FOUND;
+        return nullptr;
+    }
+    return victim->data;
+}
+
+// -----------------------------------------------------------------------------
+//  アンチエイリアスグリフ(幅 1byte とアルファ値)を描画する
+// -----------------------------------------------------------------------------
+int16_t Font::drawGlyphAA(HX8357 *display, int16_t x, int16_t y, const uint8_t *glyph, uint32_t offset, uint16_t fgcol, uint16_t bkcol)
+{
+    const uint8_t *p = glyph + 1;
+    int16_t width = (int16_t)glyph[0];
+    // 合成済みのグリフはキャッシュから写すだけで済ませる
+    // ステージングバッファを使うので、前の文字の転送中に次の文字を準備できる
+    uint32_t size = width * this->m_height;
+    uint16_t *buffer = display->getStagingBuffer();
+    const uint16_t *image = GlyphCache().get(this, offset, p, size, fgcol, bkcol, this->m_bits);
+    if( image )
+    {
+        memcpy(buffer, image, size * sizeof(uint16_t));
+    }
+    else if( this->m_bits == 8 )
+    {
+        AlphaBrend().createImage(buffer, p, size, fgcol, bkcol);
+    }
+    else
+    {
+        AlphaBrend().createPackedImage(buffer, p, size, this->m_bits, fgcol, bkcol);
+    }
+    display->submitBitmap(x, y, width, this->m_height);
+    return x + width;
+}
+
+// -----------------------------------------------------------------------------
+int16_t Font::drawChar(HX8357 *display, int16_t x, int16_t y, uint16_t code, uint16_t fgcol, uint16_t bkcol)
+{
+    if( this->m_antialiased )
+    {
+        uint32_t offset;
+        const uint8_t *glyph = this->getGlyph(code, &offset);
+        if( glyph )
+        {
+            x = this->drawGlyphAA(display, x, y, glyph, offset, fgcol, bkcol);
+        }
+        return x;
+    }
+
+    uint32_t offset = this->getOffset(code);
+    if( offset < 0xFFFFFFFF )
+    {
+        const uint32_t *p = this->m_data + offset + 1;
+        int16_t width = (int16_t)(this->m_data[offset] & 0xFF);
+        display->drawGlyph(x, y, width, this->m_height, p, fgcol, bkcol);
+        x += width;
+    }
+    return x;
+}
+
+// -----------------------------------------------------------------------------
+char *Font::getCharCodeAt(char *p, uint16_t *code)
+{
+    if( *p == 0 )
+    {
+        *code = 0x0000;
+        return p;
+    }
+    if( (*p & 0xF0) == 0xE0 )
+    {
+        *code = (((uint16_t)(*p & 0x0F))<<12) | (((uint16_t)(*(p+1) & 0x3F))<<6) | ((uint16_t)(*(p+2) & 0x3F));
+        if( *code == 0xFF5E ){ *code = 0x301C; }     // '～' の誤変換対策
+        return p+3;
+    }
+    if( (*p & 0xE0) == 0xC0 )
+    {
+        *code = (((uint16_t)(*p & 0x1F))<<6) | ((uint16_t)(*(p+1) & 0x3F));
+        return p+2;
+    }
+    else if( 0x20 <= *p && *p <= 0x7E )
+    {
+        *code = (uint16_t)*p;
+        return p+1;
+    }
+    *code = 0x0000;
+    return p+1;
+}
+
+// -----------------------------------------------------------------------------
+int16_t Font::drawString(HX8357 *display, int16_t x, int16_t y, const char *text, uint16_t fgcol, uint16_t bkcol)
+{
+    char *p = const_cast<char *>(text);
+    uint16_t code;
+    while( *p )
+    {
+        p = Font::getCharCodeAt(p, &code);
+        if( code )
+        {
+            x = this->drawChar(display, x, y, code, fgcol, bkcol);
+        }
+    }
+    return x;
+}
+
+// -----------------------------------------------------------------------------
+int16_t Font::getTextWidth(const char *text)
+{
+    char *p = const_cast<char *>(text);
+    uint16_t code;
+    int16_t w = 0;
+    while( *p )
+    {
+        p = Font::getCharCodeAt(p, &code);
+        if( code )
+        {
+            uint32_t offset;
+            if( this->m_antialiased )
+            {
+                const uint8_t *glyph = this->getGlyph(code, &offset);
+                if( glyph )
+                {
+                    w += (int16_t)glyph[0];
+                }
+            }
+            else
+            {
+                offset = this->getOffset(code);
+                if( offset < 0xFFFFFFFF )
+                {
+                    w += (int16_t)(this->m_data[offset] & 0xFF);
+                }
+            }
+        }
+    }
+    return w;
+}
+
+// -----------------------------------------------------------------------------
+//  文字列をグリフの並びに分解する(フォントにない文字は除く)
+// -----------------------------------------------------------------------------
+void Font::shape(const char *text, GlyphRun *run)
 {
+    run->reserve((uint16_t)strlen(text));
+    run->m_font = this;
+    run->m_count = 0;
+    run->m_width = 0;
 
-}
-Font::Font(uint8_t height, const uint8_t *data, const uint32_t *map)
-    : m_height(height), m_data(nullptr), m_dataAA(data), m_map(map), m_antialiased(true)
-{
-    Serial.print("offset of '0' : ");
-    Serial.println(this->m_map['0'], HEX);
+    char *p = const_cast<char *>(text);
+    uint16_t code;
+    while( *p )
+    {
+        p = Font::getCharCodeAt(p, &code);
+        if( code == 0 )
+        {
+            continue;
+        }
+        uint32_t offset;
+        int16_t width;
+        if( this->m_antialiased )
+        {
+            const uint8_t *glyph = this->getGlyph(code, &offset);
+            if( !glyph )
+            {
+                continue;
+            }
+            width = (int16_t)glyph[0];
+        }
+        else
+        {
+            offset = this->getOffset(code);
+            if( offset == Font::NOT_FOUND )
+            {
+                continue;
+            }
+            width = (int16_t)(this->m_data[offset] & 0xFF);
+        }
+        GlyphRun::Glyph *g = &run->m_glyphs[run->m_count++];
+        g->code = code;
+        g->width = width;
+        g->offset = offset;
+        run->m_width += width;
+    }
 }
 
 // -----------------------------------------------------------------------------
-int16_t Font::drawChar(HX8357 *display, int16_t x, int16_t y, uint16_t code, uint16_t fgcol, uint16_t bkcol)
+//  shape() で分解したグリフの並びのうち first 番目から last 番目の手前までを描画する
+//  ファイルから読み込むフォントの場合、グリフデータはキャッシュを通して得る
+// -----------------------------------------------------------------------------
+int16_t Font::drawRun(HX8357 *display, int16_t x, int16_t y, const GlyphRun *run, uint16_t fgcol, uint16_t bkcol, uint16_t first, uint16_t last)
 {
-    uint32_t offset = this->m_map[code];
-    if( offset < 0xFFFFFFFF )
+    last = min(last, run->m_count);
+    for( uint16_t n = first ; n < last ; n++ )
     {
-        if( this->m_antialiased )
+        const GlyphRun::Glyph *g = &run->m_glyphs[n];
+        if( g->offset == Font::NOT_FOUND )
+        {
+            continue;   // 読み込んだデータで、このフォントにない文字
+        }
+        if( !this->m_antialiased )
         {
-            const uint8_t *p = this->m_dataAA + offset + 1;
-            int16_t width = (int16_t)this->m_dataAA[offset];
-            uint16_t *image = AlphaBrend().createImage(p, width * this->m_height, fgcol, bkcol);
-            display->drawBitmap(x, y, width, this->m_height, image);
-            x += width;
+            display->drawGlyph(x, y, g->width, this->m_height, this->m_data + g->offset + 1, fgcol, bkcol);
+            x += g->width;
+        }
+        else if( !this->m_file )
+        {
+            if( this->isValidGlyph(g->offset) )
+            {
+                x = this->drawGlyphAA(display, x, y, this->m_dataAA + g->offset, g->offset, fgcol, bkcol);
+            }
         }
         else
         {
-            const uint32_t *p = this->m_data + offset + 1;
-            int16_t width = (int16_t)(this->m_data[offset] & 0xFF);
-            display->drawGlyph(x, y, width, this->m_height, p, fgcol, bkcol);
-            x += width;
+            x = this->drawChar(display, x, y, g->code, fgcol, bkcol);
         }
     }
     return x;
 }
 
 // -----------------------------------------------------------------------------
-char *Font::getCharCodeAt(char *p, uint16_t *code)
+//  １文字を Surface に合成する(offset はファイルから読み込むフォントでは使わない)
+// -----------------------------------------------------------------------------
+int16_t Font::renderChar(Surface *surface, int16_t x, int16_t y, uint16_t code, uint32_t offset, uint16_t fgcol, uint16_t bkcol)
 {
-    if( *p == 0 )
+    uint16_t *buffer = Surface::getScratch();
+    if( !this->m_antialiased )
     {
-        *code = 0x0000;
-        return p;
+        const uint32_t *p = this->m_data + offset + 1;
+        int16_t width = (int16_t)(this->m_data[offset] & 0xFF);
+        if( surface->overlaps(x, y, width, this->m_height) && (width * this->m_height <= Surface::SCRATCH_PIXELS) )
+        {
+            uint16_t *q = buffer;
+            for( int16_t j = 0 ; j < this->m_height ; j++ )
+            {
+                uint32_t mask = ((uint32_t)1) << j;
+                for( int16_t i = 0 ; i < width ; i++ )
+                {
+                    *q++ = (p[i] & mask)? fgcol : bkcol;
+                }
+            }
+            surface->drawImage(x, y, width, this->m_height, buffer);
+        }
+        return x + width;
     }
-    if( (*p & 0xF0) == 0xE0 )
+
+    const uint8_t *glyph = nullptr;
+    if( this->m_file )
     {
-        *code = (((uint16_t)(*p & 0x0F))<<12) | (((uint16_t)(*(p+1) & 0x3F))<<6) | ((uint16_t)(*(p+2) & 0x3F));
-        if( *code == 0xFF5E ){ *code = 0x301C; }     // '～' の誤変換対策
-        return p+3;
+        glyph = this->getGlyph(code, &offset);
     }
-    if( (*p & 0xE0) == 0xC0 )
+    else if( this->isValidGlyph(offset) )
     {
-        *code = (((uint16_t)(*p & 0x1F))<<6) | ((uint16_t)(*(p+1) & 0x3F));
-        return p+2;
+        glyph = this->m_dataAA + offset;
     }
-    else if( 0x20 <= *p && *p <= 0x7E )
+    if( !glyph )
     {
-        *code = (uint16_t)*p;
-        return p+1;
+        return x;
     }
-    *code = 0x0000;
-    return p+1;
+    int16_t width = (int16_t)glyph[0];
+    if( surface->overlaps(x, y, width, this->m_height) )
+    {
+        uint32_t size = width * this->m_height;
+        const uint16_t *image = GlyphCache().get(this, offset, glyph + 1, size, fgcol, bkcol, this->m_bits);
+        if( !image && (size <= Surface::SCRATCH_PIXELS) )
+        {
+            if( this->m_bits == 8 )
+            {
+                AlphaBrend().createImage(buffer, glyph + 1, size, fgcol, bkcol);
+            }
+            else
+            {
+                AlphaBrend().createPackedImage(buffer, glyph + 1, size, this->m_bits, fgcol, bkcol);
+            }
+            image = buffer;
+        }
+        if( image )
+        {
+            surface->drawImage(x, y, width, this->m_height, image);
+        }
+    }
+    return x + width;
 }
 
 // -----------------------------------------------------------------------------
-int16_t Font::drawString(HX8357 *display, int16_t x, int16_t y, const char *text, uint16_t fgcol, uint16_t bkcol)
+//  文字列を Surface に合成する
+// -----------------------------------------------------------------------------
+int16_t Font::renderString(Surface *surface, int16_t x, int16_t y, const char *text, uint16_t fgcol, uint16_t bkcol)
 {
     char *p = const_cast<char *>(text);
     uint16_t code;
@@ -88,50 +1063,107 @@ int16_t Font::drawString(HX8357 *display, int16_t x, int16_t y, const char *text
         p = Font::getCharCodeAt(p, &code);
         if( code )
         {
-            x = this->drawChar(display, x, y, code, fgcol, bkcol);
+            uint32_t offset = this->m_file? 0 : this->getOffset(code);
+            if( offset != Font::NOT_FOUND )
+            {
+                x = this->renderChar(surface, x, y, code, offset, fgcol, bkcol);
+            }
         }
     }
     return x;
 }
 
 // -----------------------------------------------------------------------------
-int16_t Font::getTextWidth(const char *text)
+int16_t Font::renderRun(Surface *surface, int16_t x, int16_t y, const GlyphRun *run, uint16_t fgcol, uint16_t bkcol, uint16_t first, uint16_t last)
 {
-    char *p = const_cast<char *>(text);
-    uint16_t code;
-    int16_t w = 0;
-    while( *p )
+    last = min(last, run->m_count);
+    for( uint16_t n = first ; n < last ; n++ )
     {
-        p = Font::getCharCodeAt(p, &code);
-        if( code )
+        const GlyphRun::Glyph *g = &run->m_glyphs[n];
+        if( g->offset != Font::NOT_FOUND )
         {
-            uint32_t offset = this->m_map[code];
-            if( offset < 0xFFFFFFFF )
-            {
-                if( this->m_antialiased )
-                {
-                    w += (int16_t)this->m_dataAA[offset];
-                }
-                else
-                {
-                    w += (int16_t)(this->m_data[offset] & 0xFF);
-                }
-            }
+            x = this->renderChar(surface, x, y, g->code, g->offset, fgcol, bkcol);
         }
     }
-    return w;
+    return x;
+}
+
+
+// -----------------------------------------------------------------------------
+//  GlyphRun
+// -----------------------------------------------------------------------------
+uint32_t GlyphRun::s_signatures[GlyphRun::NUM_FONTS] = {0, 0};
+
+void GlyphRun::reserve(uint16_t count)
+{
+    if( this->m_capacity < count )
+    {
+        delete[] this->m_glyphs;
+        this->m_glyphs = new GlyphRun::Glyph[count];
+        this->m_capacity = count;
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  run の内容を写す(font は run を作ったときのフォント)
+// -----------------------------------------------------------------------------
+void GlyphRun::assign(const GlyphRun *run, Font *font)
+{
+    this->reserve(run->m_count);
+    memcpy(this->m_glyphs, run->m_glyphs, run->m_count * sizeof(GlyphRun::Glyph));
+    this->m_font = font;
+    this->m_count = run->m_count;
+    this->m_width = run->m_width;
 }
 
+// -----------------------------------------------------------------------------
+//  create_playdata.py が出力した分解済みのデータを読み込む
+//      全体の幅(2byte), オフセット(4byte × count), 各文字の幅(1byte × count)
+//  文字コード(codes)はフォントごとに共通なので、呼び出し側で読んでおく
+//  ファイルが途中で終わっていれば空にして false を返す
+// -----------------------------------------------------------------------------
+bool GlyphRun::load(File& f, const uint16_t *codes, uint8_t count)
+{
+    uint32_t offsets[256];
+    uint8_t widths[256];
+    uint16_t width;
+    if( (f.read((uint8_t *)&width, 2) != 2) ||
+        (f.read((uint8_t *)offsets, count * 4) != (int)(count * 4)) ||
+        (f.read(widths, count) != (int)count) )
+    {
+        this->clear();
+        return false;
+    }
+
+    this->reserve(count);
+    this->m_font = nullptr;
+    this->m_count = count;
+    this->m_width = (int16_t)width;
+    for( uint8_t n = 0 ; n < count ; n++ )
+    {
+        this->m_glyphs[n].code = codes[n];
+        this->m_glyphs[n].width = widths[n];
+        this->m_glyphs[n].offset = offsets[n];
+    }
+    return true;
+}
 
 // -----------------------------------------------------------------------------
 //  Icon
 // -----------------------------------------------------------------------------
 // uint16_t *Icon::m_buffer = nullptr;
 
-Icon::Icon(const uint8_t *addr) : m_data(addr+2)
+Icon::Icon(const uint8_t *addr)
 {
+    // 先頭が 0 ならランレングス圧縮された形式(幅 0 のアイコンはないので区別できる)
+    this->m_runLength = (addr[0] == 0);
+    if( this->m_runLength )
+    {
+        addr++;
+    }
     this->m_width  = addr[0];
     this->m_height = addr[1];
+    this->m_data   = addr + 2;
     // if( Icon::m_buffer == nullptr )
     // {
     //     Icon::m_buffer = new uint16_t[Icon::BUFFER_SIZE];
@@ -141,9 +1173,26 @@ Icon::Icon(const uint8_t *addr) : m_data(addr+2)
 // -----------------------------------------------------------------------------
 void Icon::draw(HX8357 *display, int16_t x, int16_t y, uint16_t fgcol, uint16_t bkcol)
 {
-    int size = this->getSize();
-    uint16_t *image = AlphaBrend().createImage(this->m_data, size, fgcol, bkcol);
-    display->drawBitmap(x, y, this->m_width, this->m_height, image);
+    // 同じ色の組み合わせで合成済みならそのまま転送する
+    const uint16_t *image = IconCache().find(this->m_data, 0, this->getSize(), fgcol, bkcol);
+    if( image )
+    {
+        display->drawBitmap(x, y, this->m_width, this->m_height, image);
+        return;
+    }
+    // ランレングス圧縮されていれば、キャッシュには登録せず展開しながら直接送る
+    // (縁のピクセルだけ合成すればよいので、合成して覚えておくまでもない)
+    if( this->drawStream(display, x, y, fgcol, bkcol) )
+    {
+        return;
+    }
+    image = IconCache().get(this->m_data, 0, this->m_data, this->getSize(), fgcol, bkcol, this->getBits());
+    if( image )
+    {
+        display->drawBitmap(x, y, this->m_width, this->m_height, image);
+        return;
+    }
+    this->drawBlend(display, x, y, fgcol, bkcol);
     // for( int i = 0 ; i < size ; i++ )
     // {
     //     Icon::m_buffer[i] = Icon::alphaBlendRGB565(fgcol, bkcol, this->m_data[i]);
@@ -151,6 +1200,212 @@ void Icon::draw(HX8357 *display, int16_t x, int16_t y, uint16_t fgcol, uint16_t
     // display->drawBitmap(x, y, this->m_width, this->m_height, Icon::m_buffer);
 }
 
+// -----------------------------------------------------------------------------
+//  ランレングス圧縮されたアイコンを展開しながら直接送る
+//  透明・不透明の連続は塗りつぶしとして送り、縁のピクセルだけ合成する
+//  圧縮されていない場合やクリップ範囲からはみ出す場合は false を返す
+// -----------------------------------------------------------------------------
+bool Icon::drawStream(HX8357 *display, int16_t x, int16_t y, uint16_t fgcol, uint16_t bkcol)
+{
+    if( !this->m_runLength || !display->beginPixels(x, y, this->m_width, this->m_height) )
+    {
+        return false;
+    }
+    uint16_t edge[64];
+    const uint8_t *source = this->m_data;
+    int remain = this->getSize();
+    while( remain > 0 )
+    {
+        // 壊れたデータでもウィンドウの外へは送らない(命令の長さを残りで切り詰める)
+        uint8_t tag = *source++;
+        int16_t n = (tag < 0x80)? tag + 1 : (tag & 0x3F) + 1;
+        if( n > remain )
+        {
+            n = remain;
+        }
+        if( tag < 0x80 )
+        {
+            display->pushRun(bkcol, n);
+        }
+        else if( tag < 0xC0 )
+        {
+            display->pushRun(fgcol, n);
+        }
+        else
+        {
+            for( int16_t i = 0 ; i < n ; i++ )
+            {
+                edge[i] = AlphaBrender::alphaBlendRGB565(fgcol, bkcol, *source++);
+            }
+            display->pushPixels(edge, n);
+        }
+        remain -= n;
+    }
+    return true;
+}
+
+// -----------------------------------------------------------------------------
+//  ステージングバッファで全体を合成してから送る
+// -----------------------------------------------------------------------------
+void Icon::drawBlend(HX8357 *display, int16_t x, int16_t y, uint16_t fgcol, uint16_t bkcol)
+{
+    uint16_t *buffer = display->getStagingBuffer();
+    if( this->m_runLength )
+    {
+        AlphaBrend().createRunLengthImage(buffer, this->m_data, this->getSize(), fgcol, bkcol);
+    }
+    else
+    {
+        AlphaBrend().createImage(buffer, this->m_data, this->getSize(), fgcol, bkcol);
+    }
+    display->submitBitmap(x, y, this->m_width, this->m_height);
+}
+
+// -----------------------------------------------------------------------------
+//  Surface に合成する
+// -----------------------------------------------------------------------------
+void Icon::render(Surface *surface, int16_t x, int16_t y, uint16_t fgcol, uint16_t bkcol)
+{
+    int size = this->getSize();
+    if( !surface->overlaps(x, y, this->m_width, this->m_height) || (size > Surface::SCRATCH_PIXELS) )
+    {
+        return;
+    }
+    const uint16_t *image = IconCache().get(this->m_data, 0, this->m_data, size, fgcol, bkcol, this->getBits());
+    if( image == nullptr )
+    {
+        uint16_t *buffer = Surface::getScratch();
+        if( this->m_runLength )
+        {
+            AlphaBrend().createRunLengthImage(buffer, this->m_data, size, fgcol, bkcol);
+        }
+        else
+        {
+            AlphaBrend().createImage(buffer, this->m_data, size, fgcol, bkcol);
+        }
+        image = buffer;
+    }
+    surface->drawImage(x, y, this->m_width, this->m_height, image);
+}
+
+// -----------------------------------------------------------------------------
+//  RunLengthImage
+// -----------------------------------------------------------------------------
+RunLengthImage::RunLengthImage(const uint16_t *addr) : m_data(addr+2)
+{
+    this->m_width  = addr[0];
+    this->m_height = addr[1];
+}
+
+// -----------------------------------------------------------------------------
+//  cursor の位置から len ピクセルを展開する(buffer が nullptr なら読み飛ばす)
+// -----------------------------------------------------------------------------
+void RunLengthImage::read(Cursor *cursor, uint16_t *buffer, uint32_t len)
+{
+    while( len > 0 )
+    {
+        if( cursor->remain == 0 )
+        {
+            uint16_t tag = *cursor->p++;
+            cursor->run = (tag & 0x8000) != 0;
+            cursor->remain = tag & 0x7FFF;
+            continue;
+        }
+        uint32_t n = min(len, (uint32_t)cursor->remain);
+        if( cursor->run )
+        {
+            if( buffer )
+            {
+                for( uint32_t i = 0 ; i < n ; i++ ){ *buffer++ = *cursor->p; }
+            }
+            if( cursor->remain == n )
+            {
+                cursor->p++;
+            }
+        }
+        else
+        {
+            if( buffer )
+            {
+                memcpy(buffer, cursor->p, n*2);
+                buffer += n;
+            }
+            cursor->p += n;
+        }
+        cursor->remain -= n;
+        len -= n;
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  画像全体がクリップ範囲に収まる場合は、同じ色の連続を塗りつぶしとして直接送る
+//  はみ出す場合はステージングバッファに数行ずつ展開して送る
+// -----------------------------------------------------------------------------
+void RunLengthImage::draw(HX8357 *display, int16_t x, int16_t y)
+{
+    Cursor cursor = {this->m_data, 0, false};
+    uint32_t remain = (uint32_t)this->m_width * (uint32_t)this->m_height;
+    if( display->beginPixels(x, y, this->m_width, this->m_height) )
+    {
+        while( remain > 0 )
+        {
+            if( cursor.remain == 0 )
+            {
+                uint16_t tag = *cursor.p++;
+                cursor.run = (tag & 0x8000) != 0;
+                cursor.remain = tag & 0x7FFF;
+            }
+            // 壊れたデータでも画像の範囲を超えて送らないようにする
+            uint32_t n = min(remain, (uint32_t)cursor.remain);
+            if( cursor.run )
+            {
+                display->pushRun(*cursor.p++, n);
+            }
+            else
+            {
+                display->pushPixels(cursor.p, n);
+                cursor.p += cursor.remain;
+            }
+            remain -= n;
+            cursor.remain = 0;
+        }
+        return;
+    }
+    int16_t rows = max(1, HX8357::STAGING_PIXELS / this->m_width);
+    for( int16_t row = 0 ; row < this->m_height ; row += rows )
+    {
+        int16_t h = min(rows, (int16_t)(this->m_height - row));
+        uint16_t *buffer = display->getStagingBuffer();
+        RunLengthImage::read(&cursor, buffer, (uint32_t)this->m_width * h);
+        display->submitBitmap(x, y + row, this->m_width, h);
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  Surface に１行ずつ展開して描画する
+// -----------------------------------------------------------------------------
+void RunLengthImage::render(Surface *surface, int16_t x, int16_t y)
+{
+    if( !surface->overlaps(x, y, this->m_width, this->m_height) || (this->m_width > Surface::SCRATCH_PIXELS) )
+    {
+        return;
+    }
+    Cursor cursor = {this->m_data, 0, false};
+    uint16_t *buffer = Surface::getScratch();
+    for( int16_t row = 0 ; row < this->m_height ; row++ )
+    {
+        if( surface->overlaps(x, y + row, this->m_width, 1) )
+        {
+            RunLengthImage::read(&cursor, buffer, this->m_width);
+            surface->drawImage(x, y + row, this->m_width, 1, buffer);
+        }
+        else
+        {
+            RunLengthImage::read(&cursor, nullptr, this->m_width);
+        }
+    }
+}
+
 
 // -----------------------------------------------------------------------------
 //  Bitmap
@@ -168,6 +1423,109 @@ void Bitmap::load(File& f)
     f.read((uint8_t *)(this->m_data), 2*size);
 }
 
+// -----------------------------------------------------------------------------
+//  ファイルから CHUNK_SIZE バイトずつ読み込んで１バイトずつ返す(Bitmap::loadCompressed で使う)
+// -----------------------------------------------------------------------------
+class ChunkReader
+{
+    private:
+        enum{CHUNK_SIZE = 512};
+        File    *m_file;
+        uint32_t m_remain;      // ファイルに残っている圧縮データのバイト数
+        uint8_t  m_chunk[CHUNK_SIZE];
+        int      m_pos;
+        int      m_length;
+    public:
+        ChunkReader(File *f, uint32_t size) : m_file(f), m_remain(size), m_pos(0), m_length(0){}
+        bool isEnd(){ return (this->m_pos >= this->m_length) && (this->m_remain == 0); }
+        uint8_t read(){
+            if( this->m_pos >= this->m_length )
+            {
+                int n = this->m_file->read(this->m_chunk, min(this->m_remain, (uint32_t)CHUNK_SIZE));
+                this->m_remain = (n > 0)? this->m_remain - n : 0;
+                this->m_length = max(n, 0);
+                this->m_pos = 0;
+                if( this->m_length == 0 )
+                {
+                    return 0;
+                }
+            }
+            return this->m_chunk[this->m_pos++];
+        }
+};
+
+// -----------------------------------------------------------------------------
+//  圧縮された画像を読み込む(形式は playdata/create_playdata.py の encode_cover を参照)
+//  全体を読み込まずに、小さなバッファに少しずつ読みながら展開する
+//  ファイルから読み込んだバイト数を返す
+// -----------------------------------------------------------------------------
+uint32_t Bitmap::loadCompressed(File& f)
+{
+    uint32_t size = 0;
+    f.read((uint8_t *)&size, 4);
+    ChunkReader reader(&f, size);
+    uint16_t index[64];
+    memset(index, 0, sizeof(index));
+    int16_t r = 0, g = 0, b = 0;
+    uint16_t color = 0;
+    uint16_t *p = this->m_data;
+    uint16_t *end = p + ((uint32_t)this->m_width)*((uint32_t)this->m_height);
+    while( p < end )
+    {
+        if( reader.isEnd() )
+        {
+            // データが足りない場合は残りを黒で埋める
+            memset(p, 0, (end - p)*2);
+            break;
+        }
+        uint8_t tag = reader.read();
+        if( tag >= 0xC0 && tag != 0xFE )
+        {
+            for( int n = min((int)(tag & 0x3F) + 1, (int)(end - p)) ; n-- ; ){ *p++ = color; }
+            continue;
+        }
+        if( tag == 0xFE )
+        {
+            color = reader.read();
+            color |= (uint16_t)reader.read() << 8;
+            r = color >> 11;
+            g = (color >> 5) & 0x3F;
+            b = color & 0x1F;
+        }
+        else if( tag < 0x40 )
+        {
+            color = index[tag];
+            r = color >> 11;
+            g = (color >> 5) & 0x3F;
+            b = color & 0x1F;
+        }
+        else
+        {
+            if( tag < 0x80 )
+            {
+                r += ((tag >> 4) & 3) - 2;
+                g += ((tag >> 2) & 3) - 2;
+                b += (tag & 3) - 2;
+            }
+            else
+            {
+                int16_t dg = (tag & 0x3F) - 32;
+                uint8_t rb = reader.read();
+                r += (dg >> 1) + (rb >> 4) - 8;     // R, B の差は G の差の半分からの差として持つ
+                g += dg;
+                b += (dg >> 1) + (rb & 0x0F) - 8;
+            }
+            r &= 0x1F;
+            g &= 0x3F;
+            b &= 0x1F;
+            color = (r << 11) | (g << 5) | b;
+        }
+        index[(r*3 + g*5 + b*7) % 64] = color;
+        *p++ = color;
+    }
+    return 4 + size;
+}
+
 // -----------------------------------------------------------------------------
 void Bitmap::draw(HX8357 *display, int16_t x, int16_t y)
 {
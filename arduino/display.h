@@ -201,6 +201,15 @@ class Rect
         bool include(const Point& pt){
             return include(pt.x, pt.y);
         }
+        bool include(const Rect& rc){
+            return (left <= rc.left) && (rc.left+rc.width <= left+width) &&
+                   (top <= rc.top) && (rc.top+rc.height <= top+height);
+        }
+        bool intersect(const Rect& rc){
+            return (left < rc.left+rc.width) && (rc.left < left+width) &&
+                   (top < rc.top+rc.height) && (rc.top < top+height);
+        }
+        bool isEmpty(){ return (width <= 0) || (height <= 0); }
         Rect& move(int16_t x, int16_t y){
             left = x;
             top = y;
@@ -246,45 +255,393 @@ class AlphaBrender
     friend AlphaBrender& AlphaBrend();
     private:
         enum{BUFFER_SIZE = 48*48};
+        enum{TABLE_THRESHOLD = 64};     // これより小さい画像は表を作らずに直接合成する
         uint16_t m_buffer[BUFFER_SIZE];
         AlphaBrender(){}
     public:
         uint16_t *createImage(const uint8_t *source, int16_t size, uint16_t fgcol, uint16_t bkcol){
-            for( int16_t i = 0 ; i < size ; i++ )
+            return createImage(this->m_buffer, source, size, fgcol, bkcol);
+        }
+        // 前景色・背景色は画像全体で共通なので、合成結果はアルファ値(32段階)
+        // だけで決まる。33通りの結果を先に求めておき、１回に２ピクセルずつ表を引く
+        uint16_t *createImage(uint16_t *buffer, const uint8_t *source, int16_t size, uint16_t fgcol, uint16_t bkcol){
+            if( size < TABLE_THRESHOLD )
+            {
+                for( int16_t i = 0 ; i < size ; i++ )
+                {
+                    buffer[i] = alphaBlendRGB565(fgcol, bkcol, source[i]);
+                }
+                return buffer;
+            }
+            uint16_t table[33];
+            for( uint8_t a = 0 ; a <= 32 ; a++ )
+            {
+                table[a] = alphaBlend32(fgcol, bkcol, a);
+            }
+            uint16_t *p = buffer;
+            const uint8_t *end = source + (size & ~1);
+            while( source < end )
+            {
+                uint16_t c0 = table[(source[0] + 4) >> 3];
+                uint16_t c1 = table[(source[1] + 4) >> 3];
+                p[0] = c0;
+                p[1] = c1;
+                p += 2;
+                source += 2;
+            }
+            if( size & 1 )
+            {
+                *p = table[(*source + 4) >> 3];
+            }
+            return buffer;
+        }
+        // 4bit または 2bit に詰めたアルファ値(先頭のピクセルが上位ビット)から合成する
+        // 量子化値 q は 8bit の q*255/(2^bits-1) として扱い、表を引きながら展開する
+        uint16_t *createPackedImage(uint16_t *buffer, const uint8_t *source, int16_t size, uint8_t bits, uint16_t fgcol, uint16_t bkcol){
+            uint16_t table[16];
+            uint8_t levels = (1 << bits) - 1;
+            for( uint8_t q = 0 ; q <= levels ; q++ )
+            {
+                table[q] = alphaBlendRGB565(fgcol, bkcol, (uint8_t)((q * 255) / levels));
+            }
+            uint16_t *p = buffer;
+            uint16_t *end = buffer + size;
+            if( bits == 4 )
+            {
+                while( p + 2 <= end )
+                {
+                    uint8_t v = *source++;
+                    p[0] = table[v >> 4];
+                    p[1] = table[v & 0x0F];
+                    p += 2;
+                }
+                if( p < end )
+                {
+                    *p = table[*source >> 4];
+                }
+            }
+            else
+            {
+                while( p + 4 <= end )
+                {
+                    uint8_t v = *source++;
+                    p[0] = table[v >> 6];
+                    p[1] = table[(v >> 4) & 0x03];
+                    p[2] = table[(v >> 2) & 0x03];
+                    p[3] = table[v & 0x03];
+                    p += 4;
+                }
+                for( uint8_t shift = 6 ; p < end ; shift -= 2 )
+                {
+                    *p++ = table[(*source >> shift) & 0x03];
+                }
+            }
+            return buffer;
+        }
+        // ランレングス圧縮したアルファ値(icon/rle.py を参照)を展開しながら合成する
+        uint16_t *createRunLengthImage(uint16_t *buffer, const uint8_t *source, int16_t size, uint16_t fgcol, uint16_t bkcol){
+            uint16_t *p = buffer;
+            uint16_t *end = buffer + size;
+            while( p < end )
             {
-                this->m_buffer[i] = alphaBlendRGB565(fgcol, bkcol, source[i]);
+                uint8_t tag = *source++;
+                int16_t n = (tag < 0x80)? tag + 1 : (tag & 0x3F) + 1;
+                if( n > end - p )
+                {
+                    n = end - p;    // 壊れたデータでも buffer の外へは書かない
+                }
+                if( tag < 0x80 )
+                {
+                    while( n-- ){ *p++ = bkcol; }
+                }
+                else if( tag < 0xC0 )
+                {
+                    while( n-- ){ *p++ = fgcol; }
+                }
+                else
+                {
+                    while( n-- ){ *p++ = alphaBlendRGB565(fgcol, bkcol, *source++); }
+                }
             }
-            return this->m_buffer;
+            return buffer;
         }
         static uint16_t alphaBlendRGB565(uint32_t fg, uint32_t bg, uint8_t alpha) __attribute__((always_inline)) {
-            alpha = ( alpha + 4 ) >> 3; // from 0-255 to 0-31
+            return alphaBlend32(fg, bg, ( alpha + 4 ) >> 3);   // from 0-255 to 0-32
+        }
+        static uint16_t alphaBlend32(uint32_t fg, uint32_t bg, uint8_t alpha) __attribute__((always_inline)) {
             bg = (bg | (bg << 16)) & 0b00000111111000001111100000011111;
             fg = (fg | (fg << 16)) & 0b00000111111000001111100000011111;
             uint32_t result = ((((fg - bg) * alpha) >> 5) + bg) & 0b00000111111000001111100000011111;
             return (uint16_t)((result >> 16) | result); // contract result
         }
+#ifdef HX8357_STATS
+        static uint32_t selfTest();
+#endif
 };
 AlphaBrender& AlphaBrend();
 
+// -----------------------------------------------------------------------------
+// BlendCache
+//  合成済み画像(RGB565)のキャッシュ
+//  (持ち主, 番号, 前景色, 背景色) をキーとして、合成結果を
+//  使用バイト数の上限まで保持する。上限を超えたら最も長く使われていない
+//  ものから捨てる(LRU)
+
+// 有効にするとキャッシュを PSRAM に置く
+// #define BLEND_CACHE_EXTMEM
+
+// アイコンのキャッシュの上限(バイト)
+// ツールバーのボタン(32×32)の通常時と押下時、状態アイコン(48×48)３つが収まる大きさ
+#define ICON_CACHE_BYTES    (48*1024)
+
+class BlendCache
+{
+    private:
+        enum{NUM_BUCKETS = 256};
+        struct Entry
+        {
+            const void    *owner;       // フォントやアイコンデータ
+            uint32_t       id;          // 持ち主の中での番号(グリフのオフセットなど)
+            uint16_t       fgcol;
+            uint16_t       bkcol;
+            uint32_t       size;        // ピクセル数
+            Entry         *prev;        // LRU リスト(m_head が最も新しい)
+            Entry         *next;
+            Entry         *chain;       // 同じバケットの次のエントリ
+            uint16_t       pixels[1];
+        };
+        Entry   *m_buckets[NUM_BUCKETS];
+        Entry   *m_head;
+        Entry   *m_tail;
+        uint32_t m_budget;              // 使用バイト数の上限
+        uint32_t m_used;
+        uint32_t m_hits;
+        uint32_t m_misses;
+
+        static uint32_t hash(const void *owner, uint32_t id, uint16_t fgcol, uint16_t bkcol);
+        static uint32_t entryBytes(uint32_t size){ return sizeof(Entry) + (size - 1) * sizeof(uint16_t); }
+        void unlink(Entry *e);
+        void remove(Entry *e);
+
+    public:
+        enum{RUN_LENGTH = 0};   // get() の bits に指定するとランレングス圧縮したアルファ値として扱う
+        BlendCache(uint32_t budget);
+        const uint16_t *find(const void *owner, uint32_t id, uint32_t size, uint16_t fgcol, uint16_t bkcol);
+        const uint16_t *get(const void *owner, uint32_t id, const uint8_t *source, uint32_t size, uint16_t fgcol, uint16_t bkcol, uint8_t bits=8);
+        void setBudget(uint32_t budget);
+        void clear();
+        uint32_t getHits(){ return this->m_hits; }
+        uint32_t getMisses(){ return this->m_misses; }
+        uint32_t getUsedBytes(){ return this->m_used; }
+        void resetCounters(){ this->m_hits = this->m_misses = 0; }
+};
+
+// アンチエイリアスフォント用
+BlendCache& GlyphCache();
+// アイコン用(持ち主はアイコンデータ、番号は 0)
+BlendCache& IconCache();
+
+// -----------------------------------------------------------------------------
+// FontFile
+//  フォントファイル(font2bin.py が出力する)の読み出し元
+//  ファイルの形式(リトルエンディアン)
+//      0   'FNT1'
+//      4   文字高さ(1byte), アルファ値のビット数(1byte), 予備(2byte)
+//      8   マップデータの語数
+//      12  グリフデータのバイト数
+//      16  １文字のグリフデータの最大バイト数
+//      20  マップデータ(２段の表)、続いてグリフデータ
+class FontFile
+{
+    public:
+        enum{HEADER_SIZE = 20};
+        virtual ~FontFile(){}
+        virtual bool read(uint32_t pos, void *buffer, uint32_t len) = 0;
+};
+
+// SD カード上のファイル
+class SDFontFile : public FontFile
+{
+    private:
+        File m_file;
+    public:
+        SDFontFile(const char *path);
+        ~SDFontFile();
+        bool read(uint32_t pos, void *buffer, uint32_t len);
+};
+
+// W25Q64 に書き込んだファイル
+//  FIRST_SECTOR が目録(ファイルごとの開始セクタ・サイズ・CRC)で、
+//  続くセクタにファイルをサイズに合わせて詰めて書き込む(END_SECTOR の手前まで)
+//  サムネイル画像はセクタ 0 から(アルバムごとに２セクタ)使っているので重ならないこと
+class FlashFontFile : public FontFile
+{
+    private:
+        enum{CHUNK_SIZE = 240};
+        enum{SECTOR_SIZE = 4096};
+        enum{DIRECTORY_MAGIC = 0x52494446};     // 'FDIR'
+        enum{MAX_FILES = 4};
+        struct Entry
+        {
+            uint32_t sector;
+            uint32_t size;
+            uint32_t crc;
+        };
+        struct Directory
+        {
+            uint32_t magic;
+            uint32_t count;
+            Entry    entries[MAX_FILES];
+        };
+        uint32_t m_base;
+        uint32_t m_size;
+        static bool readDirectory(Directory *dir);
+        static bool inspect(const char *path, uint32_t *size, uint32_t *crc);
+    public:
+        enum{FIRST_SECTOR = 1536};      // 6MB 以降
+        enum{END_SECTOR = 2048};        // W25Q64 は 8MB
+        FlashFontFile(uint8_t index);
+        bool read(uint32_t pos, void *buffer, uint32_t len);
+        static bool install(const char * const *paths, uint8_t count);
+};
+
+// -----------------------------------------------------------------------------
+// Surface
+//  RAM 上の描画先(RGB565)
+//  画面上の矩形 rc に対応し、描画はこの矩形で切り取られる
+//  塗りつぶし・文字・アイコンを重ねて合成し、できた画像を一度だけ転送するために使う
+class Surface
+{
+    private:
+        uint16_t *m_pixels;
+        Rect      m_rc;         // 画面座標
+        Rect      m_clip;       // 描き込んでよい範囲(画面座標、m_rc の内側)
+    public:
+        enum{SCRATCH_PIXELS = 48*48};   // 文字・アイコン１つを合成する作業領域の大きさ
+        Surface(uint16_t *pixels, Rect rc) : m_pixels(pixels), m_rc(rc), m_clip(rc){}
+        uint16_t *getPixels(){ return this->m_pixels; }
+        const Rect& getRect(){ return this->m_rc; }
+        bool overlaps(int16_t x, int16_t y, int16_t w, int16_t h){
+            return (x < this->m_clip.left+this->m_clip.width) && (this->m_clip.left < x+w) &&
+                   (y < this->m_clip.top+this->m_clip.height) && (this->m_clip.top < y+h);
+        }
+        void setClip(Rect rc);
+        void fillRect(Rect rc, uint16_t color);
+        void drawImage(int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *image);
+        static uint16_t *getScratch();
+};
+
+// -----------------------------------------------------------------------------
+// GlyphRun
+//  文字列を Font::shape() で前もって文字ごとのグリフに分解したもの
+//  描画のたびに UTF-8 の解析やマップの検索をしなくて済む
+//  create_playdata.py が分解済みのデータを出力した場合は load() で読み込む
+//  (この場合 getFont() は nullptr で、データを作ったときと同じフォントで描画すること)
+//  データを作ったときのフォントのシグネチャを setFontSignature() で登録したものと照合して、
+//  違っていれば読み込んだデータは使わない
+class Font;
+class GlyphRun
+{
+    friend class Font;
+    private:
+        struct Glyph
+        {
+            uint16_t code;
+            uint16_t width;
+            uint32_t offset;    // グリフデータのオフセット
+        };
+        Font    *m_font;
+        Glyph   *m_glyphs;
+        uint16_t m_count;
+        uint16_t m_capacity;
+        int16_t  m_width;       // 全体の幅(px)
+        void reserve(uint16_t count);
+    public:
+        enum{NUM_FONTS = 2};
+    private:
+        static uint32_t s_signatures[NUM_FONTS];
+    public:
+        static void setFontSignature(uint8_t index, uint32_t signature){ s_signatures[index] = signature; }
+        static bool matchFontSignature(uint8_t index, uint32_t signature){
+            return (s_signatures[index] != 0) && (s_signatures[index] == signature);
+        }
+        GlyphRun() : m_font(nullptr), m_glyphs(nullptr), m_count(0), m_capacity(0), m_width(0){}
+        ~GlyphRun(){ delete[] this->m_glyphs; }
+        void clear(){ this->m_count = 0; this->m_width = 0; }
+        void assign(const GlyphRun *run, Font *font);
+        bool load(File& f, const uint16_t *codes, uint8_t count);
+        Font *getFont() const { return this->m_font; }
+        uint16_t getCount() const { return this->m_count; }
+        int16_t getWidth() const { return this->m_width; }
+        int16_t getGlyphWidth(uint16_t n) const { return this->m_glyphs[n].width; }
+        bool isSameGlyph(uint16_t n, const GlyphRun *run, uint16_t m) const {
+            return (this->m_glyphs[n].offset == run->m_glyphs[m].offset) && (this->m_glyphs[n].code == run->m_glyphs[m].code);
+        }
+};
+
 // -----------------------------------------------------------------------------
 // Font
 //  フォントを表すクラス
+//  マップデータは次のどちらかの形式(bmpfont.py が出力する)
+//    ・文字コードで直接引く 65536 要素の表
+//    ・MAP_MAGIC に続き、上位バイトで引くページ位置 256 要素と、
+//      使われている上位バイトごとのページ(先頭の語 = 最初の下位バイト | 最後の下位バイト << 8、
+//      続いて最初～最後の下位バイトのオフセット)
 class Font
 {
     private:
+        enum{MAP_MAGIC = 0x50414D46};   // 'FMAP'
+        enum{NOT_FOUND = 0xFFFFFFFF};
         uint8_t         m_height;       // 文字高さ(px)
         const uint32_t *m_data;         // グリフデータの配列(非アンチエイリアス)
         const uint8_t  *m_dataAA;       // 同(アンチエイリアス)
         const uint32_t *m_map;          // 文字コードからグリフデータ配列のオフセットを得るためのマップデータ
         bool            m_antialiased;  // アンチエイリアスフォントの場合は true
+        bool            m_paged;        // マップデータが２段の表の場合は true
+        uint8_t         m_bits;         // アンチエイリアスフォントのアルファ値のビット数(8, 4, 2)
+        uint32_t        m_dataSize;     // グリフデータのバイト数(わからなければ 0)
+        uint32_t        m_signature;    // マップデータなどの CRC(GlyphRun を読み込むときに照合する)
+
+        // フォントファイルから読み込む場合
+        struct CacheSlot
+        {
+            uint16_t code;
+            uint32_t offset;            // NOT_FOUND ならその文字はない
+            uint32_t lastUsed;
+            uint8_t *data;              // 幅(1byte)とアルファ値
+        };
+        FontFile       *m_file;
+        uint32_t       *m_pages;        // 上位バイトごとのページ位置(257語、先頭は MAP_MAGIC)
+        uint32_t        m_dataPos;      // グリフデータのファイル上の位置
+        uint16_t        m_glyphBytes;   // １文字のグリフデータの最大バイト数
+        CacheSlot      *m_slots;
+        uint8_t         m_numSlots;
+        uint32_t        m_useCount;
+
         static char *getCharCodeAt(char *p, uint16_t *code);
+        uint32_t getOffset(uint16_t code);
+        uint32_t readMap(uint32_t index);
+        const uint8_t *getGlyph(uint16_t code, uint32_t *offset);
+        uint32_t getGlyphBytes(int16_t width);
+        uint32_t signatureHeader();
+        bool isValidGlyph(uint32_t offset);
+        int16_t drawGlyphAA(HX8357 *display, int16_t x, int16_t y, const uint8_t *glyph, uint32_t offset, uint16_t fgcol, uint16_t bkcol);
+        int16_t renderChar(Surface *surface, int16_t x, int16_t y, uint16_t code, uint32_t offset, uint16_t fgcol, uint16_t bkcol);
     public:
         Font(uint8_t height, const uint32_t *data, const uint32_t *map);
-        Font(uint8_t height, const uint8_t *data, const uint32_t *map);
+        Font(uint8_t height, const uint8_t *data, const uint32_t *map, uint8_t bits=8, uint32_t dataSize=0, uint32_t mapWords=0);
+        Font(FontFile *file, uint8_t numSlots=64);
+        ~Font();
+        bool isLoaded(){ return (this->m_map != nullptr) || (this->m_pages != nullptr); }
         uint8_t getHeight(){ return this->m_height; }
+        uint32_t getSignature(){ return this->m_signature; }
         int16_t drawChar(HX8357 *display, int16_t x, int16_t y, uint16_t code, uint16_t fgcol, uint16_t bkcol);
         int16_t drawString(HX8357 *display, int16_t x, int16_t y, const char *text, uint16_t fgcol, uint16_t bkcol);
         int16_t getTextWidth(const char *text);
+        void shape(const char *text, GlyphRun *run);
+        int16_t drawRun(HX8357 *display, int16_t x, int16_t y, const GlyphRun *run, uint16_t fgcol, uint16_t bkcol, uint16_t first=0, uint16_t last=0xFFFF);
+        int16_t renderString(Surface *surface, int16_t x, int16_t y, const char *text, uint16_t fgcol, uint16_t bkcol);
+        int16_t renderRun(Surface *surface, int16_t x, int16_t y, const GlyphRun *run, uint16_t fgcol, uint16_t bkcol, uint16_t first=0, uint16_t last=0xFFFF);
 };
 
 // -----------------------------------------------------------------------------
@@ -299,7 +656,9 @@ class Icon
         uint8_t m_width;
         uint8_t m_height;
         const uint8_t *m_data;
+        bool m_runLength;       // ランレングス圧縮されている(icon/rle.py を参照)
         int getSize(){ return (int)m_width * (int)m_height; }
+        uint8_t getBits(){ return this->m_runLength? (uint8_t)BlendCache::RUN_LENGTH : 8; }
 
     public:
         Icon(const uint8_t *addr);
@@ -307,6 +666,35 @@ class Icon
         uint8_t getHeight(){ return this->m_height; }
         const uint8_t *getData(){ return this->m_data; }
         void draw(HX8357 *display, int16_t x, int16_t y, uint16_t fgcol, uint16_t bkcol);                
+        bool drawStream(HX8357 *display, int16_t x, int16_t y, uint16_t fgcol, uint16_t bkcol);
+        void drawBlend(HX8357 *display, int16_t x, int16_t y, uint16_t fgcol, uint16_t bkcol);
+        void render(Surface *surface, int16_t x, int16_t y, uint16_t fgcol, uint16_t bkcol);
+};
+
+// -----------------------------------------------------------------------------
+// RunLengthImage
+//  ランレングス圧縮した RGB565 の画像(ロゴなど、icon/rle.py を参照)
+//  展開しながら描画する(同じ色の連続はそのまま塗りつぶしとして送る)
+class RunLengthImage
+{
+    private:
+        struct Cursor
+        {
+            const uint16_t *p;
+            uint16_t remain;    // 現在の命令の残りピクセル数
+            bool     run;       // 現在の命令が同じ色の連続か
+        };
+        int16_t m_width;
+        int16_t m_height;
+        const uint16_t *m_data;
+        static void read(Cursor *cursor, uint16_t *buffer, uint32_t len);
+
+    public:
+        RunLengthImage(const uint16_t *addr);
+        int16_t getWidth(){ return this->m_width; }
+        int16_t getHeight(){ return this->m_height; }
+        void draw(HX8357 *display, int16_t x, int16_t y);
+        void render(Surface *surface, int16_t x, int16_t y);
 };
 
 // -----------------------------------------------------------------------------
@@ -322,6 +710,7 @@ class Bitmap
         Bitmap(uint8_t w, uint8_t h);
         // void load(const char *path);
         void load(File& f);
+        uint32_t loadCompressed(File& f);
         uint8_t getWidth(){ return this->m_width; }
         uint8_t getHeight(){ return this->m_height; }
         uint16_t *getData(){ return this->m_data; }     
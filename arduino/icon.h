@@ -1,719 +1,608 @@
 const uint8_t ICON_STOP_48[] PROGMEM = {
+      0, // run-length
      48, // width (48px)
      48, // height(48px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127,127,127, 75,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151,
+     23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151, 23,151,
+     23,151, 23,151,127,127,127,127, 75,
 };
+// 60 bytes (raw 2306 bytes)
 
 const uint8_t ICON_PLAY_48[] PROGMEM = {
+      0, // run-length
      48, // width (48px)
      48, // height(48px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,179, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,240,111,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,197, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,250,136,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,219, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,254,162, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,231, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,179, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,240,111,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,197, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,250,136,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,254,162, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,231, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,231, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,254,162, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,219, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,250,136,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,197, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,240,111,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,179, 29,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,231, 85,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,254,162, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,219, 65,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,250,136,  7,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,197, 42,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,240,111,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,174, 26,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127,127,111,193,179, 29, 45,128,194,240,111,  2, 43,130,193,197, 42, 42,131,194,250,136,  7,
+     40,133,193,219, 65, 39,134,194,254,162, 18, 37,136,193,231, 85, 36,138,193,179, 29, 34,139,194,
+    240,111,  2, 32,141,193,197, 42, 31,142,194,250,136,  7, 29,144,193,219, 65, 28,145,194,254,162,
+     18, 26,147,193,231, 85, 25,147,193,231, 85, 25,145,194,254,162, 18, 26,144,193,219, 65, 28,142,
+    194,250,136,  7, 29,141,193,197, 42, 31,139,194,240,111,  2, 32,138,193,179, 29, 34,136,193,231,
+     85, 36,134,194,254,162, 18, 37,133,193,219, 65, 39,131,194,250,136,  7, 40,130,193,197, 42, 42,
+    128,194,240,111,  2, 43,193,174, 26,127,127,127,125,
 };
+// 160 bytes (raw 2306 bytes)
 
 const uint8_t ICON_PAUSE_48[] PROGMEM = {
+      0, // run-length
      48, // width (48px)
      48, // height(48px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127,127,107,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,
+    135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,
+    135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,
+    135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,
+    135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135, 23,135,  7,135,127,127,127,107,
 };
+// 122 bytes (raw 2306 bytes)
 
 const uint8_t ICON_STOP_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127,  7,143, 15,143, 15,143, 15,143, 15,143, 15,143, 15,143, 15,143, 15,143, 15,143, 15,143,
+     15,143, 15,143, 15,143, 15,143, 15,143,127,127,  7,
 };
+// 40 bytes (raw 1026 bytes)
 
 const uint8_t ICON_PLAY_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,207, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,251,145, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,221, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,170, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,233, 94,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,255,255,182, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,255,255,255,245,119,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,255,255,255,255,255,207, 52,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,255,255,255,255,255,255,251,145, 11,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,255,255,255,255,255,255,251,145, 11,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,255,255,255,255,255,207, 52,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,255,255,255,245,119,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,255,255,182, 31,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,255,233, 94,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,255,255,170, 20,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255,255,221, 69,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,251,145, 11,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,207, 52,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 19,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127, 73,193, 19,  3, 29,194, 85,207, 52, 28,196, 85,255,251,145, 11, 26,192, 85,130,193,221, 69,
+     25,192, 85,132,193,170, 20, 23,192, 85,133,193,233, 94, 22,192, 85,135,193,182, 31, 20,192, 85,
+    136,194,245,119,  3, 18,192, 85,138,193,207, 52, 17,192, 85,139,194,251,145, 11, 15,192, 85,139,
+    194,251,145, 11, 15,192, 85,138,193,207, 52, 17,192, 85,136,194,245,119,  3, 18,192, 85,135,193,
+    182, 31, 20,192, 85,133,193,233, 94, 22,192, 85,132,193,170, 20, 23,192, 85,130,193,221, 69, 25,
+    196, 85,255,251,145, 11, 26,194, 85,207, 52, 28,193, 19,  3,127, 83,
 };
+// 140 bytes (raw 1026 bytes)
 
 const uint8_t ICON_PAUSE_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 85, 85, 85, 85, 85, 28,  0,  0,  0,  0, 28, 85, 85, 85, 85, 85,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255, 85,  0,  0,  0,  0, 85,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 85, 85, 85, 85, 85, 28,  0,  0,  0,  0, 28, 85, 85, 85, 85, 85,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127, 71,197, 85, 85, 85, 85, 85, 28,  3,197, 28, 85, 85, 85, 85, 85, 15,132,192, 85,  3,192, 85,
+    132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,
+    132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,
+    132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,
+    132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,
+    132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,
+    132, 15,132,192, 85,  3,192, 85,132, 15,132,192, 85,  3,192, 85,132, 15,197, 85, 85, 85, 85, 85,
+     28,  3,197, 28, 85, 85, 85, 85, 85,127, 71,
 };
+// 182 bytes (raw 1026 bytes)
 
 const uint8_t ICON_PREV_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18,170,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,225,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  0,  0,  0,  6,145,254,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  0,  0, 45,210,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  1,111,246,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0, 25,185,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0, 78,234,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0, 11,162,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0, 11,162,255,255,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0, 78,234,255,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0, 25,185,255,255,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  1,111,246,255,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  0,  0, 45,210,255,255,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  0,  0,  0,  6,145,254,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 64,225,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,170,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 15,165,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127,  7,129,192,170, 10,193, 18,170, 15,129,192,170,  9,194, 64,225,255, 15,129,192,170,  7,
+    194,  6,145,254,129, 15,129,192,170,  6,193, 45,210,131, 15,129,192,170,  4,194,  1,111,246,132,
+     15,129,192,170,  3,193, 25,185,134, 15,129,192,170,  2,193, 78,234,135, 15,129,195,170,  0, 11,
+    162,137, 15,129,195,170,  0, 11,162,137, 15,129,192,170,  2,193, 78,234,135, 15,129,192,170,  3,
+    193, 25,185,134, 15,129,192,170,  4,194,  1,111,246,132, 15,129,192,170,  6,193, 45,210,131, 15,
+    129,192,170,  7,194,  6,145,254,129, 15,129,192,170,  9,194, 64,225,255, 15,129,192,170, 10,193,
+     15,165,127,127,  7,
 };
+// 152 bytes (raw 1026 bytes)
 
 const uint8_t ICON_NEXT_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,170, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,225, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,254,145,  6,  0,  0,  0,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,210, 45,  0,  0,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,246,111,  1,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,185, 25,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,234, 78,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,162, 11,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,162, 11,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,255,234, 78,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,255,255,185, 25,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,255,246,111,  1,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,255,255,210, 45,  0,  0,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,255,254,145,  6,  0,  0,  0,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,255,225, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,165, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,170,255,255,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127,  7,193,170, 18, 10,192,170,129, 15,128,193,225, 64,  9,192,170,129, 15,129,194,254,145,
+      6,  7,192,170,129, 15,131,193,210, 45,  6,192,170,129, 15,132,194,246,111,  1,  4,192,170,129,
+     15,134,193,185, 25,  3,192,170,129, 15,135,193,234, 78,  2,192,170,129, 15,137,195,162, 11,  0,
+    170,129, 15,137,195,162, 11,  0,170,129, 15,135,193,234, 78,  2,192,170,129, 15,134,193,185, 25,
+      3,192,170,129, 15,132,194,246,111,  1,  4,192,170,129, 15,131,193,210, 45,  6,192,170,129, 15,
+    129,194,254,145,  6,  7,192,170,129, 15,128,193,225, 64,  9,192,170,129, 15,193,165, 15, 10,192,
+    170,129,127,127,  7,
 };
+// 152 bytes (raw 1026 bytes)
 
 const uint8_t ICON_SONG_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0, 85,255,255,255,255,255,255, 85,  0,  0,
-      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0, 85,255,255,255,255,255,255, 85,  0,  0,
-      0,  0,  0,  0,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,  0,  0, 85,255,255,198,170,170,170, 56,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,170,  0,  0, 85,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0, 85,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,  0,  0, 85,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 57,  0,  0,  0,  0,  3, 56, 74,110,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,170,  0,  0,  0, 45,209,255,255,255,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,255,255,255,255,255,255,255,255,255,255,170,  0,  0, 15,225,255,255,255,255,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 57,  0,  0,122,255,255,255,255,255,255,255, 85,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,164,255,255,255,255,255,255,255, 83,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,142,255,255,255,255,255,255,255, 55,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 52,254,255,255,255,255,255,215,  3,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,110,250,255,255,255,232, 47,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 46,140,164,119, 19,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127,  3,143,  1,192, 85,133,192, 85,  5,143,  1,192, 85,133,192, 85,  5,207,170,170,170,170,
+    170,170,170,170,170,170,170,170,170,170,170,170,  1,192, 85,129,196,198,170,170,170, 56, 23,192,
+     85,129,192, 85, 27,192, 85,129,192, 85,  9,207,170,170,170,170,170,170,170,170,170,170,170,170,
+    170,170,170,170,  1,192, 85,129,192, 85,  9,143,  1,192, 85,129,192, 85,  9,143,  1,192, 85,129,
+    192, 85, 27,192, 85,129,192, 85, 27,192, 85,129,192, 85,  9,202, 85, 85, 85, 85, 85, 85, 85, 85,
+     85, 85, 57,  3,195,  3, 56, 74,110,129,192, 85,  9,137,192,170,  2,193, 45,209,132,192, 85,  9,
+    137,192,170,  1,193, 15,225,133,192, 85,  9,202, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 57,  1,
+    192,122,134,192, 85, 22,192,164,134,192, 83, 22,192,142,134,192, 55, 22,193, 52,254,132,193,215,
+      3, 23,193,110,250,130,193,232, 47, 25,196, 46,140,164,119, 19,127, 39,
 };
+// 213 bytes (raw 1026 bytes)
 
 const uint8_t ICON_ALBUM_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 20, 46, 74, 73, 45, 19,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 36,129,208,255,255,255,255,255,255,207,128, 35,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 23,149,250,255,255,255,255,255,255,255,255,255,255,250,148, 22,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 57,232,255,255,255,255,255,255,255,255,255,255,255,255,255,255,235, 63,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0, 88,248,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,248, 86,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0, 58,248,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,249, 62,  0,  0,  0,  0,  0,
-      0,  0,  0,  0, 23,233,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,231, 21,  0,  0,  0,  0,
-      0,  0,  0,  0,150,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,146,  0,  0,  0,  0,
-      0,  0,  0, 36,250,255,255,255,255,255,255,255,248,145, 55, 11, 11, 55,146,248,255,255,255,255,255,255,255,249, 34,  0,  0,  0,
-      0,  0,  0,129,255,255,255,255,255,255,255,228, 47,  0,  0,  0,  0,  0,  0, 48,228,255,255,255,255,255,255,255,127,  0,  0,  0,
-      0,  0,  0,208,255,255,255,255,255,255,248, 47,  0,  0,  0,  0,  0,  0,  0,  0, 48,248,255,255,255,255,255,255,206,  0,  0,  0,
-      0,  0, 20,255,255,255,255,255,255,255,145,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,147,255,255,255,255,255,255,254, 18,  0,  0,
-      0,  0, 47,255,255,255,255,255,255,255, 54,  0,  0,  0,  0, 48, 47,  0,  0,  0,  0, 56,255,255,255,255,255,255,255, 46,  0,  0,
-      0,  0, 72,255,255,255,255,255,255,255, 12,  0,  0,  0, 47,253,253, 46,  0,  0,  0, 13,255,255,255,255,255,255,255, 72,  0,  0,
-      0,  0, 72,255,255,255,255,255,255,255, 12,  0,  0,  0, 47,253,253, 46,  0,  0,  0, 13,255,255,255,255,255,255,255, 72,  0,  0,
-      0,  0, 47,255,255,255,255,255,255,255, 54,  0,  0,  0,  0, 46, 46,  0,  0,  0,  0, 56,255,255,255,255,255,255,255, 46,  0,  0,
-      0,  0, 19,255,255,255,255,255,255,255,146,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,147,255,255,255,255,255,255,254, 18,  0,  0,
-      0,  0,  0,207,255,255,255,255,255,255,248, 48,  0,  0,  0,  0,  0,  0,  0,  0, 48,249,255,255,255,255,255,255,205,  0,  0,  0,
-      0,  0,  0,128,255,255,255,255,255,255,255,228, 48,  0,  0,  0,  0,  0,  0, 48,228,255,255,255,255,255,255,255,126,  0,  0,  0,
-      0,  0,  0, 35,250,255,255,255,255,255,255,255,249,147, 56, 12, 12, 57,147,249,255,255,255,255,255,255,255,249, 33,  0,  0,  0,
-      0,  0,  0,  0,148,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,144,  0,  0,  0,  0,
-      0,  0,  0,  0, 22,232,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,230, 20,  0,  0,  0,  0,
-      0,  0,  0,  0,  0, 57,248,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,247, 56,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0, 86,248,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,255,247, 84,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 56,231,255,255,255,255,255,255,255,255,255,255,255,255,255,255,230, 56,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 21,146,249,255,255,255,255,255,255,255,255,255,255,249,145, 20,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 34,127,206,255,255,255,255,255,255,205,126, 33,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 18, 45, 73, 73, 45, 18,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     76,197, 20, 46, 74, 73, 45, 19, 22,194, 36,129,208,133,194,207,128, 35, 17,194, 23,149,250,137,
+    194,250,148, 22, 14,193, 57,232,141,193,235, 63, 12,193, 88,248,143,193,248, 86, 10,193, 58,248,
+    145,193,249, 62,  8,193, 23,233,147,193,231, 21,  7,192,150,149,192,146,  6,193, 36,250,134,199,
+    248,145, 55, 11, 11, 55,146,248,134,193,249, 34,  5,192,129,134,193,228, 47,  5,193, 48,228,134,
+    192,127,  5,192,208,133,193,248, 47,  7,193, 48,248,133,192,206,  4,192, 20,134,192,145,  9,192,
+    147,133,193,254, 18,  3,192, 47,134,192, 54,  3,193, 48, 47,  3,192, 56,134,192, 46,  3,192, 72,
+    134,192, 12,  2,195, 47,253,253, 46,  2,192, 13,134,192, 72,  3,192, 72,134,192, 12,  2,195, 47,
+    253,253, 46,  2,192, 13,134,192, 72,  3,192, 47,134,192, 54,  3,193, 46, 46,  3,192, 56,134,192,
+     46,  3,192, 19,134,192,146,  9,192,147,133,193,254, 18,  4,192,207,133,193,248, 48,  7,193, 48,
+    249,133,192,205,  5,192,128,134,193,228, 48,  5,193, 48,228,134,192,126,  5,193, 35,250,134,199,
+    249,147, 56, 12, 12, 57,147,249,134,193,249, 33,  6,192,148,149,192,144,  7,193, 22,232,147,193,
+    230, 20,  8,193, 57,248,145,193,247, 56, 10,193, 86,248,143,193,247, 84, 12,193, 56,231,141,193,
+    230, 56, 14,194, 21,146,249,137,194,249,145, 20, 17,194, 34,127,206,133,194,205,126, 33, 22,197,
+     18, 45, 73, 73, 45, 18, 76,
 };
+// 322 bytes (raw 1026 bytes)
 
 const uint8_t ICON_ARTIST_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 16, 72, 71, 15,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0, 97,241,255,255,240, 95,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 72,254,255,255,255,255,255, 81,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,206,255,255,255,255,255,255,201,  0,  0,  0,  0, 66,145,145, 64,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,248,255,255,255,255,255,255,244,  0,  0,  0,116,254,255,255,254,114,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,227,255,255,255,255,255,255,222,  0,  0, 23,249,255,255,255,255,248, 21,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,136,255,255,255,255,255,255,130,  0,  0, 71,255,255,255,255,255,255, 67,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  9,180,255,255,255,255,178,  7,  0,  0, 42,255,255,255,255,255,255, 39,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  1, 86,156,156, 84,  0,  0,  0,  0,  0,181,255,255,255,255,177,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 13,148,229,229,146, 12,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  4, 54,103,129,158,162,143, 97,  3,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0, 48,156,238,255,255,255,255,255,220, 53,  0,  0,  0,  0, 11, 44, 72, 72, 44, 10,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0, 13,161,254,255,255,255,255,255,255,238, 32,  0,  0, 13,109,186,248,255,255,255,255,247,185,108, 13,  0,  0,  0,  0,
-      0,  0,  3,187,255,255,255,255,255,255,255,255,110,  0,  0, 71,234,255,255,255,255,255,255,255,255,255,255,233, 70,  0,  0,  0,
-      0,  0, 53,255,255,255,255,255,255,255,255,255, 27,  0, 27,245,255,255,255,255,255,255,255,255,255,255,255,255,244, 26,  0,  0,
-      0,  0, 85,255,255,255,255,255,255,255,255,255,  2,  0, 81,255,255,255,255,255,255,255,255,255,255,255,255,255,255, 81,  0,  0,
-      0,  0, 85,255,255,255,255,255,255,255,255,255,  0,  0, 85,255,255,255,255,255,255,255,255,255,255,255,255,255,255, 85,  0,  0,
-      0,  0, 85,255,255,255,255,255,255,255,255,255,  0,  0, 85,255,255,255,255,255,255,255,255,255,255,255,255,255,255, 85,  0,  0,
-      0,  0, 28, 85, 85, 85, 85, 85, 85, 85, 85, 85,  0,  0, 28, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 85, 28,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127, 73,195, 16, 72, 71, 15, 26,193, 97,241,129,193,240, 95, 24,193, 72,254,132,192, 81, 23,192,
+    206,133,192,201,  3,195, 66,145,145, 64, 15,192,248,133,192,244,  2,193,116,254,129,193,254,114,
+     14,192,227,133,192,222,  1,193, 23,249,131,193,248, 21, 13,192,136,133,192,130,  1,192, 71,133,
+    192, 67, 13,193,  9,180,131,193,178,  7,  1,192, 42,133,192, 39, 14,196,  1, 86,156,156, 84,  4,
+    192,181,131,192,177, 25,197, 13,148,229,229,146, 12, 45,200,  4, 54,103,129,158,162,143, 97,  3,
+     20,194, 48,156,238,132,193,220, 53,  3,197, 11, 44, 72, 72, 44, 10,  9,194, 13,161,254,133,193,
+    238, 32,  1,195, 13,109,186,248,131,195,247,185,108, 13,  5,193,  3,187,135,192,110,  1,193, 71,
+    234,137,193,233, 70,  4,192, 53,136,195, 27,  0, 27,245,139,193,244, 26,  3,192, 85,136,194,  2,
+      0, 81,141,192, 81,  3,192, 85,136,  1,192, 85,141,192, 85,  3,192, 85,136,  1,192, 85,141,192,
+     85,  3,201, 28, 85, 85, 85, 85, 85, 85, 85, 85, 85,  1,207, 28, 85, 85, 85, 85, 85, 85, 85, 85,
+     85, 85, 85, 85, 85, 85, 28,127, 65,
 };
+// 252 bytes (raw 1026 bytes)
 
 const uint8_t ICON_UP_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,199,204, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,199,255,255,204, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,199,255,255,255,255,204, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,198,255,255,215,215,255,255,198, 14,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 14,199,255,255,217, 26, 23,212,255,255,204, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0, 14,199,255,255,217, 26,  0,  0, 23,212,255,255,204, 17,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 14,199,255,255,217, 26,  0,  0,  0,  0, 23,212,255,255,204, 17,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,184,255,255,215, 25,  0,  0,  0,  0,  0,  0, 25,215,255,255,184,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 51,238,217, 26,  0,  0,  0,  0,  0,  0,  0,  0, 23,212,241, 56,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0, 53, 25,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 25, 53,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127, 78,193, 14, 14, 28,195, 14,199,204, 17, 26,193, 14,199,129,193,204, 17, 24,193, 14,199,
+    131,193,204, 17, 22,193, 14,198,129,193,215,215,129,193,198, 14, 20,193, 14,199,129,195,217, 26,
+     23,212,129,193,204, 17, 18,193, 14,199,129,193,217, 26,  1,193, 23,212,129,193,204, 17, 16,193,
+     14,199,129,193,217, 26,  3,193, 23,212,129,193,204, 17, 15,192,184,129,193,215, 25,  5,193, 25,
+    215,129,192,184, 15,195, 51,238,217, 26,  7,195, 23,212,241, 56, 16,193, 53, 25,  9,193, 25, 53,
+    127,127,104,
 };
+// 126 bytes (raw 1026 bytes)
 
 const uint8_t ICON_DOWN_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  3,163,120,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,112,170,  4,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,164,255,255,113,  0,  0,  0,  0,  0,  0,  0,  0,113,255,255,164,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 85,251,255,255,120,  0,  0,  0,  0,  0,  0,112,255,255,252, 92,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0, 85,251,255,255,120,  0,  0,  0,  0,112,255,255,252, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,251,255,255,120,  0,  0,112,255,255,252, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,251,255,255,120,112,255,255,252, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88,252,255,255,255,255,252, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,251,255,255,252, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 85,251,252, 92,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 88, 88,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127,127, 72,192,  1, 11,192,  1, 16,194,  3,163,120,  9,194,112,170,  4, 15,192,164,129,192,113,
+      7,192,113,129,192,164, 15,193, 85,251,129,192,120,  5,192,112,129,193,252, 92, 16,193, 85,251,
+    129,192,120,  3,192,112,129,193,252, 92, 18,193, 85,251,129,192,120,  1,192,112,129,193,252, 92,
+     20,193, 85,251,129,193,120,112,129,193,252, 92, 22,193, 88,252,131,193,252, 88, 24,193, 85,251,
+    129,193,252, 92, 26,195, 85,251,252, 92, 28,193, 88, 88,127,127,110,
 };
+// 116 bytes (raw 1026 bytes)
 
 const uint8_t ICON_CLOSE_32[] PROGMEM = {
+      0, // run-length
      32, // width (32px)
      32, // height(32px)
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 73,247,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,247, 79,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0, 28,247,255,253,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,253,255,247, 28,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 98,253,255,254,106,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,105,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,106,  0,  0,  0,  0,  0,  0, 98,253,255,254,105,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,106,  0,  0,  0,  0, 98,253,255,254,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,106,  0,  0, 98,253,255,254,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,106, 98,253,255,254,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,253,255,253,253,255,253,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,255,254,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,255,254,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,253,255,253,253,255,253,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,105, 98,253,255,254,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,105,  0,  0, 98,253,255,254,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,105,  0,  0,  0,  0, 98,253,255,254,106,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,105,  0,  0,  0,  0,  0,  0, 98,253,255,254,106,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 98,253,255,254,105,  0,  0,  0,  0,  0,  0,  0,  0, 98,253,255,254,106,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0, 28,247,255,253,100,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,100,253,255,247, 28,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0, 73,246,105,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 98,247, 79,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0, 28,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
-      0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+    127, 71,192, 28, 13,192, 28, 14,194, 73,247,106, 11,194, 98,247, 79, 12,196, 28,247,255,253,100,
+      9,196,100,253,255,247, 28, 12,196, 98,253,255,254,106,  7,196, 98,253,255,254,105, 14,196, 98,
+    253,255,254,106,  5,196, 98,253,255,254,105, 16,196, 98,253,255,254,106,  3,196, 98,253,255,254,
+    105, 18,196, 98,253,255,254,106,  1,196, 98,253,255,254,105, 20,201, 98,253,255,254,106, 98,253,
+    255,254,105, 22,199,100,253,255,253,253,255,253,100, 24,193, 98,253,129,193,254,105, 25,193, 98,
+    253,129,193,254,106, 24,199,100,253,255,253,253,255,253,100, 22,201, 98,253,255,254,105, 98,253,
+    255,254,106, 20,196, 98,253,255,254,105,  1,196, 98,253,255,254,106, 18,196, 98,253,255,254,105,
+      3,196, 98,253,255,254,106, 16,196, 98,253,255,254,105,  5,196, 98,253,255,254,106, 14,196, 98,
+    253,255,254,105,  7,196, 98,253,255,254,106, 12,196, 28,247,255,253,100,  9,196,100,253,255,247,
+     28, 12,194, 73,246,105, 11,194, 98,247, 79, 14,192, 28, 13,192, 28,127, 71,
 };
+// 238 bytes (raw 1026 bytes)
 
 const uint16_t LOGO[] PROGMEM = {
     0x012C,0x0096,    // width = 300, height = 150
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0021,0x08C5,0x11AA,0x1A70,0x2314,0x2B76,0x2B97,0x2BD8,0x341A,0x341A,0x33F9,0x2BB8,0x2B76,0x2B55,0x22D2,0x1A0D,0x0948,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x0927,0x1A4E,0x2B55,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BB8,0x22D2,0x11AA,0x08A4,0x0020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08C5,0x1A0D,0x2313,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B76,0x1A90,0x1169,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x11AB,0x2313,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B97,0x1A4F,0x0907,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08E5,0x1A70,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B34,0x118A,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08A4,0x1A4E,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2314,0x1169,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x1A0D,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22F3,0x0927,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1189,0x2B76,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x33F9,0x1A70,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0906,0x22D2,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B97,0x11EC,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x11CB,0x2BB8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22D2,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A2E,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x341A,0x2BD8,0x2B76,0x2B55,0x2B97,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B55,0x08C4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x22B1,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x341A,0x2314,0x1A0D,0x118A,0x0927,0x08C5,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0021,0x08A4,0x0906,0x1169,0x11CB,0x1A90,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BB8,0x08E5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0020,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x341A,0x22F3,0x11AA,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08E6,0x1A4E,0x2BB7,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0927,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x2B35,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x33F9,0x22F3,0x11AB,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0020,0x0907,0x1A4F,0x2B97,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1169,0x0020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22D2,0x08E6,0x0020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x11EC,0x2BB8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11AA,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08A4,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B55,0x118A,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08C5,0x1A90,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11CB,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x2B35,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BB8,0x1A2E,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0948,0x2314,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1169,0x0020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0021,0x22D2,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22B1,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0041,0x11CB,0x2BB8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BD8,0x0927,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A2E,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x33F9,0x19EC,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08E6,0x2334,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B55,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x19EC,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BB7,0x1189,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08A4,0x22D2,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2313,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1148,0x2B97,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B55,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A4F,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A4F,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x2314,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2313,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x19EC,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x33F9,0x118A,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A2E,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A4E,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0948,0x2B97,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B55,0x08C4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A0D,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08E6,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x2334,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1189,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x341A,0x118A,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A0C,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2314,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A0D,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2313,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08E6,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BB7,0x08E6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x22B1,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A0D,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A6F,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11AA,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B76,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0907,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A2E,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0927,0x2B96,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A2D,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A2E,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22F3,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x11EC,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2334,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08A4,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11AB,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08A4,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11AB,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x11CB,0x2BB8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2313,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x19EC,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22D2,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0021,0x22F3,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11CB,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08C5,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x33F9,0x0927,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0927,0x2B97,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2314,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A0D,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A4E,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A2E,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11EC,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08C5,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B35,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2334,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A2E,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x118A,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1189,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x19EC,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08E6,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A6F,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BD8,0x08E6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x22D2,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B76,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x2335,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22F3,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x19EC,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1168,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0907,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A2E,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0927,0x2B96,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A2D,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x11CB,0x2BB8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x341A,0x0927,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0020,0x2314,0x343A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22F2,0x0084,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A90,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B55,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A2E,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B97,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0020,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A4E,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0948,0x2B97,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0927,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1148,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0021,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x118A,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0906,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B76,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A4F,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A0D,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1169,0x2B97,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2314,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A0D,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0063,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x11EC,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22D2,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x11CB,0x2BB8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22F3,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A4F,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1189,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B76,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A70,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A4E,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0948,0x2B97,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B97,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x22B1,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A0D,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08E6,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BB7,0x08E5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x22D2,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11AB,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08A4,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BD8,0x08E6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x22F2,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1169,0x0020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0062,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x33F9,0x08E6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2313,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0927,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0020,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x341A,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0907,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00A4,0x09AB,0x1271,0x1B36,0x1B78,0x1B78,0x12D3,0x0949,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00A4,0x122F,0x1B36,0x1B78,0x1B78,0x12D3,0x1270,0x09CD,0x0084,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0928,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00C5,0x12D4,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x09CC,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00E6,0x12F4,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0021,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1148,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x08C5,0x1169,0x11EC,0x0083,0x0000,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x0949,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x12B3,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x0000,0x118A,0x11AA,0x0907,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x2335,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1169,0x0020,0x0000,0x0041,0x0907,0x11AB,0x1A4E,0x22D2,0x2B56,0x33F9,0x343A,0x343B,0x343B,0x343B,0x1A6F,0x0063,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1292,0x0084,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x098B,0x1B15,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x1148,0x2B97,0x343B,0x343B,0x343B,0x341A,0x2BB7,0x2314,0x1A90,0x19ED,0x1169,0x08A4,0x0020,0x0000,0x0063,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x118A,0x0021,0x1A0D,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1271,0x1B57,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B76,0x0907,0x08A4,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x11AB,0x1A4F,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x22D2,0x1148,0x2B55,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2334,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x22B1,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BB8,0x08E5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A2E,0x2BD9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2334,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08C5,0x2B76,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1169,0x0020,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x08E6,0x2334,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BB7,0x1169,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0021,0x1148,0x1A6F,0x2313,0x2334,0x2334,0x2334,0x2334,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B76,0x2334,0x2334,0x2334,0x2334,0x22D2,0x19EC,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2334,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x0906,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x22D2,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x33F9,0x08E6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A6F,0x33F9,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2B76,0x08C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0948,0x2B97,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A0D,0x0042,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1A0D,0x2BD8,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1292,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x11CC,0x2B97,0x341A,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x1A90,0x0083,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B57,0x00C5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1271,0x1B57,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x118A,0x2BB7,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x343B,0x2BD9,0x1A70,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0062,0x0907,0x11AA,0x1A0D,0x1A70,0x22F2,0x2B55,0x2BD8,0x341A,0x343B,0x343B,0x1A2E,0x0062,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1271,0x0083,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x098B,0x1B15,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x0927,0x2B96,0x343B,0x343B,0x33F9,0x2B97,0x2314,0x22B1,0x1A4E,0x11CC,0x1169,0x08A4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0020,0x0083,0x08E6,0x0062,0x0000,0x0000,0x0000,0x0000,0x0949,0x1AF5,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B57,0x0927,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x1291,0x1B57,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x122F,0x0063,0x0000,0x0000,0x0000,0x0021,0x08C5,0x08A4,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0928,0x12F4,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B57,0x096A,0x0021,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0083,0x1292,0x1B57,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x1B78,0x11EE,0x0062,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x00C5,0x098B,0x122F,0x1291,0x1B36,0x1B16,0x1250,0x00C6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0042,0x09AC,0x12D3,0x1B57,0x12D3,0x1271,0x09ED,0x0928,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5370,0x95FC,0x95DC,0x42AD,0x0000,0x0000,0x0000,0x42AD,0x95DC,0x95BB,0x42AD,0x0000,0x0000,0x1905,0x7CF8,0x9E1D,0x8D9A,0x31E9,0x0000,0x0000,0x1905,0x7CF8,0x9E1D,0x8D9A,0x31E9,0x0000,0x0000,0x0000,0x5BB2,0x95FC,0x9E1D,0x9E1D,0x8D9A,0x29C8,0x0000,0x0000,0x0000,0x1905,0x8539,0x9E1D,0x9E1D,0x9E1D,0x74B6,0x0862,0x0000,0x0000,0x0000,0x0000,0x29A8,0x8539,0x9E1D,0x9E1D,0x95FC,0x63F3,0x0000,0x0000,0x0000,0x0000,0x0000,0x31E9,0x8D9B,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8DBB,0x6C34,0x1925,0x0000,0x0000,0x0000,0x0000,0x0000,0x4B0E,0x95BB,0x9E1D,0x9E1D,0x8DBB,0x428C,0x0000,0x0000,0x0000,0x0000,0x0000,0x6413,0x95FD,0x9E1D,0x9E1D,0x7CD7,0x10C3,0x0000,0x0000,0x0000,0x5350,0x95FC,0x95FC,0x5350,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2166,0x8559,0x9E1D,0x9E1D,0x9E1D,0x6413,0x0000,0x0000,0x0000,0x0000,0x5350,0x95FC,0x9E1D,0x9E1D,0x95BB,0x428C,0x0000,0x0000,0x0000,0x63F3,0x95FC,0x95FC,0x5370,0x0000,0x0000,0x0000,0x63F3,0x95FC,0x95FC,0x5370,0x0000,0x0000,0x0000,0x0882,0x5BB2,0x8D9B,0x95FD,0x9E1D,0x9E1D,0x8DBB,0x5BD2,0x0882,0x0000,0x0000,0x0000,0x29A8,0x8D7A,0x9E1D,0x8539,0x1925,0x0000,0x0000,0x0000,0x0000,0x1925,0x6C34,0x8DBB,0x9E1D,0x9E1D,0x95BB,0x7496,0x2166,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5370,0x95FC,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FC,0x855A,0x5350,0x0041,0x0000,0x0000,0x0000,0x31E9,0x8D9B,0x9E1D,0x6C55,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x4B0E,0x95BB,0x9E1D,0x9E1D,0x8DBB,0x428C,0x0000,0x0000,0x0000,0x428C,0x8D9B,0x95DC,0x534F,0x0000,0x0000,0x0000,0x0000,0x0000,0x63F3,0x95FC,0x855A,0x29C8,0x0862,0x7475,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FD,0x7475,0x0862,0x0000,0x31E9,0x8D9B,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8DBB,0x6C34,0x1925,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x10E4,0x8559,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x4AEE,0x95FC,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x10E4,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x6C75,0x0000,0x0000,0x0000,0x532F,0x961D,0x9E1D,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x0000,0x0000,0x0000,0x6C75,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x63F3,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8D9B,0x31E9,0x0000,0x0000,0x0000,0x1925,0x8D7A,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x5B91,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x534F,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95BB,0x3209,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x2146,0x8D7A,0x9E1D,0x9E1D,0x8559,0x10E4,0x0000,0x2167,0x8D9B,0x9E1D,0x9E1D,0x8559,0x10E4,0x0000,0x0000,0x74B6,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CD7,0x0862,0x0000,0x0000,0x63F3,0x9E1D,0x9E1D,0x9E1D,0x534F,0x0000,0x0000,0x0000,0x4B0E,0x95DC,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95DC,0x42AD,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CD7,0x0882,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1925,0x8D7A,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x8D9B,0x2187,0x0000,0x0000,0x0000,0x3A6B,0x95DC,0x9E1D,0x9E1D,0x6C34,0x2987,0x8DBB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x63F3,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8D9B,0x31E9,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x42CD,0x95FC,0x9E1D,0x9E1D,0x6C75,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8D9B,0x2167,0x0000,0x0862,0x7CF8,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95DC,0x320A,0x0000,0x0000,0x0000,0x1925,0x8D7A,0x9E1D,0x9E1D,0x95FD,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x0000,0x42CD,0x95FC,0x9E1D,0x961D,0x961D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x2146,0x8D7A,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8518,0x0862,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x42CD,0x95FC,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7475,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x320A,0x95DC,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95DC,0x3A6B,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x29C9,0x8DBB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8D7A,0x2166,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95BB,0x29C8,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x42CD,0x95FC,0x9E1D,0x961D,0x961D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x5370,0x961D,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x0000,0x74B6,0x9E1D,0x9E1D,0x95DC,0x3A6B,0x29A8,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FD,0x7475,0x0862,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x74B6,0x9E1D,0x9E1D,0x95DC,0x3A6B,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x961D,0x532F,0x0000,0x3209,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x8DBB,0x63F3,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x3209,0x855A,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x7CF7,0x7CF7,0x9E1D,0x9E1D,0x6413,0x0000,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95DC,0x3A4B,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x6C75,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x42AC,0x95FC,0x9E1D,0x9E1D,0x5BD2,0x0000,0x3A4B,0x95DC,0x9E1D,0x9E1D,0x5BB1,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x63F3,0x9E1D,0x9E1D,0x9E1D,0x7CF7,0x10C3,0x2187,0x855A,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0041,0x534F,0x95DC,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x7CF7,0x7CF7,0x9E1D,0x9E1D,0x6413,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x8D7A,0x2166,0x0000,0x322A,0x95DC,0x9E1D,0x9E1D,0x74B6,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x3209,0x855A,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x3209,0x95BB,0x9E1D,0x9E1D,0x7CF8,0x0862,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8D7A,0x95FC,0x9E1D,0x74B6,0x0000,0x5B91,0x9E1D,0x9E1D,0x8538,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x6413,0x9E1D,0x9E1D,0x8518,0x3A2A,0x95DC,0x9E1D,0x95DC,0x3A4B,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x9E1D,0x5350,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x5BB1,0x5BB1,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8539,0x961D,0x9E1D,0x6413,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95DC,0x8D9B,0x9E1D,0x95DC,0x3A6B,0x1925,0x8D7A,0x9E1D,0x8DBB,0x8D9A,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x42AD,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x74B6,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x63F3,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x74B6,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x5BB1,0x5BB1,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x0000,0x4AEE,0x95FC,0x9E1D,0x9E1D,0x5B91,0x0000,0x6C75,0x9E1D,0x9E1D,0x95DC,0x322A,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x6413,0x9E1D,0x9E1D,0x961D,0x532F,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7475,0x8559,0x9E1D,0x8D9B,0x29A8,0x7CF7,0x9E1D,0x95DC,0x5B91,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x63F3,0x10C3,0x8539,0x9E1D,0x9E1D,0x5BB1,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x3A4B,0x95DC,0x9E1D,0x95DC,0x3A4B,0x3A4B,0x95DC,0x9E1D,0x95DC,0x320A,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x63D2,0x8D9B,0x9E1D,0x8559,0x1905,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x63F3,0x9E1D,0x9E1D,0x6413,0x42AC,0x95FC,0x9E1D,0x7475,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x2187,0x8D9B,0x9E1D,0x9E1D,0x7CD7,0x0882,0x0000,0x63F3,0x95FC,0x8D9A,0x31E9,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C75,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x3A4B,0x95DC,0x9E1D,0x95DC,0x3A4B,0x3A4B,0x95DC,0x9E1D,0x95DC,0x320A,0x0000,0x0000,0x0000,0x74B6,0x9E1D,0x9E1D,0x8D7A,0x428C,0x95BB,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x961D,0x4B2F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7D18,0x31E9,0x8559,0x9E1D,0x9E1D,0x8D7A,0x1925,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x6C34,0x9E1D,0x961D,0x63D2,0x8DBB,0x9E1D,0x7CF8,0x42CD,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x3A4B,0x95DC,0x9E1D,0x95FC,0x42AC,0x0000,0x6C34,0x9E1D,0x9E1D,0x8518,0x0862,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x3209,0x855A,0x9E1D,0x9E1D,0x95FC,0x428C,0x0000,0x63F3,0x9E1D,0x9E1D,0x8559,0x1905,0x1905,0x8559,0x9E1D,0x9E1D,0x5BB1,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x6C75,0x9E1D,0x95FC,0x42CD,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x42AD,0x8DBB,0x9E1D,0x8539,0x6C75,0x9E1D,0x95FC,0x42CD,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x42AD,0x95DC,0x9E1D,0x9E1D,0x8559,0x3A4A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x29C8,0x8538,0x95BB,0x8D7A,0x428C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0041,0x534F,0x95DC,0x9E1D,0x9E1D,0x8559,0x10E4,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63F3,0x9E1D,0x9E1D,0x8559,0x1905,0x1905,0x8559,0x9E1D,0x9E1D,0x5BB1,0x0000,0x0000,0x0000,0x322A,0x95DC,0x9E1D,0x9E1D,0x95FC,0x9E1D,0x9E1D,0x8D7A,0x2166,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95DC,0x4B2F,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x3209,0x855A,0x9E1D,0x9E1D,0x8D9B,0x2987,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x5BB1,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x3A6B,0x95DC,0x9E1D,0x95FD,0x9E1D,0x9E1D,0x5B91,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x5BB1,0x9E1D,0x9E1D,0x8D7A,0x2146,0x0000,0x4AEE,0x95FC,0x9E1D,0x8DBB,0x29C8,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8539,0x10C3,0x0862,0x8518,0x9E1D,0x9E1D,0x7475,0x0000,0x0000,0x7475,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x42CD,0x95FC,0x9E1D,0x7475,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29C8,0x74B6,0x9E1D,0x9E1D,0x961D,0x9E1D,0x8D7A,0x1925,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x0000,0x3A2A,0x8D7A,0x9E1D,0x9E1D,0x9E1D,0x74B6,0x1925,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0862,0x8518,0x9E1D,0x9E1D,0x7475,0x0000,0x0000,0x7475,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FD,0x5350,0x0000,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FD,0x5B70,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95BB,0x428C,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x10C3,0x8539,0x9E1D,0x9E1D,0x9E1D,0x95BB,0x3209,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x0862,0x8518,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x2167,0x8D9B,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8D9B,0x31E9,0x0000,0x320A,0x95DC,0x9E1D,0x961D,0x4B2F,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x8DBB,0x29C8,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x10C3,0x8539,0x9E1D,0x8D9B,0x2167,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x532F,0x961D,0x9E1D,0x9E1D,0x9E1D,0x6C75,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x0000,0x0000,0x0041,0x5BB1,0x95DC,0x9E1D,0x9E1D,0x95BB,0x428C,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CD7,0x0882,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x320A,0x95DC,0x9E1D,0x961D,0x4B2F,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x8DBB,0x29C8,0x0000,0x0000,0x0000,0x2166,0x8D7A,0x9E1D,0x9E1D,0x9E1D,0x7D18,0x0882,0x0000,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95DC,0x4B2F,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8D9B,0x4AEE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x855A,0x5B91,0x63F2,0x95BB,0x9E1D,0x9E1D,0x8D7A,0x1925,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x6413,0x9E1D,0x9E1D,0x9E1D,0x7CF7,0x0000,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x29C8,0x8DBB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8D9B,0x6C34,0x1925,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x961D,0x4B2F,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x0000,0x6413,0x9E1D,0x961D,0x532F,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x2987,0x8D9B,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x29A8,0x855A,0x9E1D,0x9E1D,0x8D9B,0x29C8,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x29C8,0x8559,0x95BB,0x8D7A,0x428C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FC,0x8539,0x5350,0x0041,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x961D,0x4B2F,0x0000,0x0000,0x0000,0x0000,0x5BB1,0x9E1D,0x9E1D,0x95FC,0x4AEE,0x0000,0x0000,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7496,0x0882,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95FC,0x4AEE,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x3A4B,0x95DC,0x9E1D,0x9E1D,0x5350,0x0000,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x42AD,0x95FC,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C54,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x0000,0x320A,0x95DC,0x9E1D,0x7CF7,0x7CF8,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x74B6,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x31E9,0x8D9B,0x95FD,0x7475,0x0862,0x0000,0x3A6B,0x95DC,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x6C75,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C54,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x5B91,0x95FD,0x9E1D,0x9E1D,0x5B91,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x5370,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x0862,0x7CD7,0x9E1D,0x8D7A,0x2166,0x0000,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x0000,0x0862,0x7CF8,0x9E1D,0x95DC,0x8D9B,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x428C,0x95DC,0x9E1D,0x5BB1,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8D9B,0x2167,0x0000,0x29C8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x63F3,0x9E1D,0x9E1D,0x95BB,0x29C8,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x7CD7,0x9E1D,0x9E1D,0x9E1D,0x5370,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x2146,0x8D7A,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x9E1D,0x8DBB,0x322A,0x1925,0x8539,0x9E1D,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0041,0x2167,0x0882,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x0000,0x1905,0x1946,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x961D,0x5BB1,0x0861,0x6413,0x9E1D,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x5350,0x9E1D,0x9E1D,0x961D,0x5BB1,0x0041,0x4AEE,0x95FC,0x9E1D,0x9E1D,0x7475,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x8539,0x18E4,0x322A,0x8DBB,0x9E1D,0x9E1D,0x95FC,0x42CD,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x9E1D,0x63D2,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95DC,0x3A6B,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x6C34,0x9E1D,0x9E1D,0x95DC,0x3A4B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x2987,0x8D9B,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x6413,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x3209,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x961D,0x532F,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x3A6B,0x95DC,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CD7,0x0882,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FC,0x7475,0x0862,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FD,0x7475,0x0862,0x0000,0x6C34,0x9E1D,0x9E1D,0x95DC,0x3A4B,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8538,0x0882,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x10E4,0x8559,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x428C,0x95FC,0x9E1D,0x9E1D,0x8DBB,0x2987,0x0000,0x0000,0x428C,0x95BB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FD,0x5B70,0x0000,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x95BB,0x29C8,0x0000,0x534F,0x9E1D,0x9E1D,0x8D9B,0x2167,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x63F3,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7CD7,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x0000,0x1905,0x855A,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x0000,0x6C75,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x8DBB,0x2987,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x6C54,0x0000,0x0000,0x0000,0x1925,0x7D18,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CD7,0x0882,0x0000,0x0000,0x0000,0x5BB2,0x95FD,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x7CD7,0x0882,0x0000,0x0000,0x63F3,0x9E1D,0x9E1D,0x9E1D,0x534F,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x8539,0x1925,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95BB,0x29A8,0x7CD7,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0000,0x0000,0x534F,0x9E1D,0x9E1D,0x95FC,0x428C,0x0000,0x0000,0x0000,0x0000,0x2987,0x8DBB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x63F3,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x10E4,0x8559,0x9E1D,0x9E1D,0x9E1D,0x534F,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5370,0x95FC,0x95DC,0x42AD,0x0000,0x0000,0x0882,0x7495,0x95FD,0x9E1D,0x7475,0x0862,0x0000,0x0000,0x0000,0x1925,0x6C75,0x8DBB,0x9E1D,0x9E1D,0x95FC,0x7CF7,0x3A4A,0x0000,0x0000,0x0000,0x0000,0x0000,0x6C34,0x9E1D,0x95DC,0x428C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2187,0x8D7A,0x9E1D,0x7D18,0x10C3,0x0000,0x29C8,0x8D7A,0x9E1D,0x6C55,0x0000,0x0000,0x0000,0x0000,0x29C8,0x8D9A,0x9E1D,0x6C34,0x0000,0x0000,0x31E9,0x8D9B,0x9E1D,0x74B6,0x0862,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5350,0x95FC,0x95DC,0x4AEE,0x0000,0x0000,0x0000,0x0000,0x5350,0x95FC,0x95DC,0x42AD,0x0000,0x0862,0x74B6,0x9E1D,0x95BB,0x3A4B,0x0000,0x0000,0x0000,0x29A8,0x8559,0x9E1D,0x9E1D,0x95DC,0x42AD,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x31E9,0x8D9B,0x9E1D,0x74B6,0x0862,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x63D2,0x95FD,0x95FC,0x4B0E,0x0000,0x0000,0x0000,0x0000,0x0041,0x5B70,0x8D7A,0x95FD,0x9E1D,0x95FD,0x8D7A,0x5350,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x42AD,0x8539,0x95FD,0x9E1D,0x95FD,0x8D7A,0x5350,0x0041,0x0000,0x0000,0x0000,0x29A8,0x8D7A,0x9E1D,0x8539,0x1925,0x0000,0x0000,0x0000,0x0000,0x3A4B,0x8539,0x95FC,0x9E1D,0x95FD,0x8D7A,0x5B70,0x0041,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x5370,0x95FC,0x95FC,0x5350,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x42AD,0x8DBB,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FC,0x7475,0x0862,0x5350,0x95FC,0x95DC,0x4AEE,0x0000,0x0000,0x0000,0x0000,0x5350,0x95FC,0x95DC,0x42AD,0x0000,0x0000,0x0000,0x0000,0x1925,0x8539,0x9E1D,0x7CD7,0x0882,0x0000,0x0000,0x0000,0x0000,0x0862,0x7475,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x9E1D,0x95FC,0x7475,0x0862,0x0000,0x31E9,0x8D9B,0x9E1D,0x74B6,0x0862,0x0000,0x0000,0x4AEE,0x8D9B,0x9E1D,0x855A,0x29C8,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x8795,0x0000,0x0012,0x0021,0x08C5,0x11AA,0x1A70,0x2314,0x2B76,0x2B97,0x2BD8,0x341A,0x341A,0x33F9,0x2BB8,0x2B76,
+    0x2B55,0x22D2,0x1A0D,0x0948,0x0062,0x8116,0x0000,0x0005,0x0042,0x0927,0x1A4E,0x2B55,0x341A,0x8011,0x343B,0x0005,
+    0x2BB8,0x22D2,0x11AA,0x08A4,0x0020,0x810E,0x0000,0x0004,0x08C5,0x1A0D,0x2313,0x33F9,0x8019,0x343B,0x0004,0x2B76,
+    0x1A90,0x1169,0x0041,0x8108,0x0000,0x0004,0x0083,0x11AB,0x2313,0x33F9,0x801F,0x343B,0x0004,0x2B97,0x1A4F,0x0907,
+    0x0021,0x8103,0x0000,0x0003,0x08E5,0x1A70,0x2BD9,0x8025,0x343B,0x0003,0x2B34,0x118A,0x0041,0x80FF,0x0000,0x0003,
+    0x08A4,0x1A4E,0x2BD8,0x8029,0x343B,0x0003,0x2314,0x1169,0x0041,0x80FB,0x0000,0x0003,0x0083,0x1A0D,0x2BD8,0x802D,
+    0x343B,0x0003,0x22F3,0x0927,0x0021,0x80F8,0x0000,0x0003,0x1189,0x2B76,0x341A,0x802F,0x343B,0x0003,0x33F9,0x1A70,
+    0x0083,0x80F5,0x0000,0x0003,0x0906,0x22D2,0x33F9,0x8033,0x343B,0x0003,0x2B97,0x11EC,0x0042,0x80F2,0x0000,0x0002,
+    0x11CB,0x2BB8,0x8037,0x343B,0x0002,0x22D2,0x0083,0x80F0,0x0000,0x0002,0x1A2E,0x2BD9,0x8019,0x343B,0x0006,0x341A,
+    0x2BD8,0x2B76,0x2B55,0x2B97,0x341A,0x801A,0x343B,0x0002,0x2B55,0x08C4,0x80EE,0x0000,0x0002,0x22B1,0x341A,0x8013,
+    0x343B,0x0007,0x341A,0x2314,0x1A0D,0x118A,0x0927,0x08C5,0x0062,0x8006,0x0000,0x0007,0x0021,0x08A4,0x0906,0x1169,
+    0x11CB,0x1A90,0x2BD8,0x8014,0x343B,0x0002,0x2BB8,0x08E5,0x80EB,0x0000,0x0002,0x0020,0x2334,0x8012,0x343B,0x0004,
+    0x341A,0x22F3,0x11AA,0x0062,0x8013,0x0000,0x0004,0x08E6,0x1A4E,0x2BB7,0x341A,0x8012,0x343B,0x0001,0x0927,0x80E9,
+    0x0000,0x0002,0x0042,0x2B35,0x8010,0x343B,0x0004,0x33F9,0x22F3,0x11AB,0x0083,0x8018,0x0000,0x0005,0x0020,0x0907,
+    0x1A4F,0x2B97,0x341A,0x8010,0x343B,0x0002,0x1169,0x0020,0x80E6,0x0000,0x0002,0x0083,0x2B55,0x8010,0x343B,0x0003,
+    0x22D2,0x08E6,0x0020,0x801D,0x0000,0x0003,0x0042,0x11EC,0x2BB8,0x8010,0x343B,0x0002,0x11AA,0x0021,0x80E4,0x0000,
+    0x0002,0x08A4,0x2B55,0x800F,0x343B,0x0003,0x2B55,0x118A,0x0041,0x8021,0x0000,0x0003,0x08C5,0x1A90,0x2BD9,0x800F,
+    0x343B,0x0002,0x11CB,0x0021,0x80E2,0x0000,0x0002,0x0042,0x2B35,0x800E,0x343B,0x0003,0x2BB8,0x1A2E,0x0062,0x8025,
+    0x0000,0x0003,0x0948,0x2314,0x341A,0x800E,0x343B,0x0002,0x1169,0x0020,0x80E0,0x0000,0x0003,0x0021,0x22D2,0x341A,
+    0x800D,0x343B,0x0002,0x22B1,0x08C5,0x8028,0x0000,0x0003,0x0041,0x11CB,0x2BB8,0x800D,0x343B,0x0002,0x2BD8,0x0927,
+    0x80E0,0x0000,0x0002,0x1A2E,0x2BD9,0x800C,0x343B,0x0003,0x33F9,0x19EC,0x0042,0x802B,0x0000,0x0003,0x08E6,0x2334,
+    0x341A,0x800C,0x343B,0x0002,0x2B55,0x08C5,0x80DE,0x0000,0x0002,0x19EC,0x2BD8,0x800C,0x343B,0x0003,0x2BB7,0x1189,
+    0x0021,0x802D,0x0000,0x0003,0x08A4,0x22D2,0x33F9,0x800C,0x343B,0x0002,0x2313,0x08A4,0x80DC,0x0000,0x0002,0x1148,
+    0x2B97,0x800C,0x343B,0x0002,0x2B55,0x08C5,0x8031,0x0000,0x0002,0x1A4F,0x33F9,0x800C,0x343B,0x0002,0x1A4F,0x0062,
+    0x80DA,0x0000,0x0003,0x0083,0x2314,0x341A,0x800B,0x343B,0x0002,0x2313,0x08A4,0x8033,0x0000,0x0002,0x19EC,0x2BD8,
+    0x800B,0x343B,0x0003,0x33F9,0x118A,0x0021,0x80D9,0x0000,0x0002,0x1A2E,0x2BD9,0x800B,0x343B,0x0002,0x1A4E,0x0062,
+    0x8035,0x0000,0x0002,0x0948,0x2B97,0x800B,0x343B,0x0002,0x2B55,0x08C4,0x80D8,0x0000,0x0002,0x118A,0x2BB7,0x800B,
+    0x343B,0x0002,0x1A0D,0x0042,0x8037,0x0000,0x0002,0x08E6,0x2B76,0x800B,0x343B,0x0002,0x1A90,0x0083,0x80D6,0x0000,
+    0x0003,0x0083,0x2334,0x341A,0x800A,0x343B,0x0002,0x1A90,0x0083,0x8039,0x0000,0x0002,0x1189,0x2BB7,0x800A,0x343B,
+    0x0003,0x341A,0x118A,0x0021,0x80D5,0x0000,0x0002,0x1A0C,0x2BD8,0x800A,0x343B,0x0002,0x2314,0x08A4,0x803B,0x0000,
+    0x0002,0x1A0D,0x2BD8,0x800A,0x343B,0x0002,0x2313,0x08A4,0x80D4,0x0000,0x0002,0x08E6,0x2B76,0x800A,0x343B,0x0002,
+    0x2BB7,0x08E6,0x803D,0x0000,0x0002,0x22B1,0x341A,0x800A,0x343B,0x0002,0x1A0D,0x0042,0x80D3,0x0000,0x0002,0x1A6F,
+    0x33F9,0x800A,0x343B,0x0002,0x11AA,0x0021,0x803D,0x0000,0x0002,0x0083,0x2B55,0x800A,0x343B,0x0002,0x2B76,0x08C5,
+    0x80D2,0x0000,0x0002,0x0907,0x2B76,0x800A,0x343B,0x0002,0x1A2E,0x0062,0x803F,0x0000,0x0002,0x0927,0x2B96,0x800A,
+    0x343B,0x0002,0x1A2D,0x0042,0x80D1,0x0000,0x0002,0x1A2E,0x2BD9,0x8009,0x343B,0x0002,0x22F3,0x08A4,0x8041,0x0000,
+    0x0002,0x11EC,0x2BD8,0x8009,0x343B,0x0002,0x2334,0x08A4,0x80D0,0x0000,0x0002,0x08A4,0x2B55,0x800A,0x343B,0x0002,
+    0x11AB,0x0021,0x8041,0x0000,0x0002,0x08A4,0x2B55,0x800A,0x343B,0x0002,0x11AB,0x0021,0x80CF,0x0000,0x0002,0x11CB,
+    0x2BB8,0x8009,0x343B,0x0002,0x2313,0x08A4,0x8043,0x0000,0x0002,0x19EC,0x2BD8,0x8009,0x343B,0x0002,0x22D2,0x0083,
+    0x80CE,0x0000,0x0003,0x0021,0x22F3,0x341A,0x8009,0x343B,0x0002,0x11CB,0x0041,0x8043,0x0000,0x0002,0x08C5,0x2B76,
+    0x8009,0x343B,0x0002,0x33F9,0x0927,0x80CE,0x0000,0x0002,0x0927,0x2B97,0x8009,0x343B,0x0002,0x2314,0x08A4,0x8045,
+    0x0000,0x0002,0x1A0D,0x2BD8,0x8009,0x343B,0x0002,0x1A4E,0x0062,0x80CD,0x0000,0x0002,0x1A2E,0x2BD9,0x8009,0x343B,
+    0x0002,0x11EC,0x0041,0x8045,0x0000,0x0002,0x08C5,0x2B76,0x8009,0x343B,0x0002,0x2B35,0x08A4,0x80CC,0x0000,0x0002,
+    0x0083,0x2B55,0x8009,0x343B,0x0002,0x2334,0x08A4,0x8047,0x0000,0x0002,0x1A2E,0x2BD9,0x8009,0x343B,0x0002,0x118A,
+    0x0021,0x80CB,0x0000,0x0002,0x1189,0x2BB7,0x8009,0x343B,0x0002,0x19EC,0x0042,0x8047,0x0000,0x0002,0x08E6,0x2B76,
+    0x8009,0x343B,0x0002,0x1A90,0x0083,0x80CB,0x0000,0x0002,0x1A6F,0x33F9,0x8008,0x343B,0x0002,0x2BD8,0x08E6,0x8049,
+    0x0000,0x0002,0x22D2,0x341A,0x8008,0x343B,0x0002,0x2B76,0x08C5,0x80CA,0x0000,0x0002,0x0042,0x2335,0x8009,0x343B,
+    0x0002,0x22F3,0x08A4,0x8049,0x0000,0x0002,0x19EC,0x2BD8,0x8009,0x343B,0x0001,0x1168,0x80CA,0x0000,0x0002,0x0907,
+    0x2B76,0x8009,0x343B,0x0002,0x1A2E,0x0062,0x8049,0x0000,0x0002,0x0927,0x2B96,0x8009,0x343B,0x0002,0x1A2D,0x0042,
+    0x80C9,0x0000,0x0002,0x11CB,0x2BB8,0x8008,0x343B,0x0002,0x341A,0x0927,0x804A,0x0000,0x0003,0x0020,0x2314,0x343A,
+    0x8008,0x343B,0x0002,0x22F2,0x0084,0x80C9,0x0000,0x0002,0x1A90,0x33F9,0x8008,0x343B,0x0002,0x2B55,0x08A4,0x804B,
+    0x0000,0x0002,0x1A2E,0x2BD9,0x8008,0x343B,0x0002,0x2B97,0x08C5,0x80C8,0x0000,0x0002,0x0020,0x2334,0x8009,0x343B,
+    0x0002,0x1A4E,0x0062,0x804B,0x0000,0x0002,0x0948,0x2B97,0x8009,0x343B,0x0001,0x0927,0x80C8,0x0000,0x0002,0x0083,
+    0x2B55,0x8009,0x343B,0x0001,0x1148,0x804C,0x0000,0x0002,0x0021,0x2334,0x8009,0x343B,0x0002,0x118A,0x0021,0x80C7,
+    0x0000,0x0002,0x0906,0x2B76,0x8008,0x343B,0x0002,0x2B76,0x08C5,0x804D,0x0000,0x0002,0x1A4F,0x33F9,0x8008,0x343B,
+    0x0002,0x1A0D,0x0042,0x80C7,0x0000,0x0002,0x1169,0x2B97,0x8008,0x343B,0x0002,0x2314,0x08A4,0x804D,0x0000,0x0002,
+    0x1A0D,0x2BD8,0x8008,0x343B,0x0002,0x1A90,0x0063,0x80C7,0x0000,0x0002,0x11EC,0x2BD8,0x8008,0x343B,0x0002,0x22D2,
+    0x0083,0x804D,0x0000,0x0002,0x11CB,0x2BB8,0x8008,0x343B,0x0002,0x22F3,0x08A4,0x80C7,0x0000,0x0002,0x1A4F,0x33F9,
+    0x8008,0x343B,0x0002,0x1A90,0x0083,0x804D,0x0000,0x0002,0x1189,0x2BB7,0x8008,0x343B,0x0002,0x2B76,0x08C5,0x80C7,
+    0x0000,0x0002,0x1A70,0x33F9,0x8008,0x343B,0x0002,0x1A4E,0x0062,0x804D,0x0000,0x0002,0x0948,0x2B97,0x8008,0x343B,
+    0x0002,0x2B97,0x08C5,0x80C7,0x0000,0x0002,0x22B1,0x341A,0x8008,0x343B,0x0002,0x1A0D,0x0042,0x804D,0x0000,0x0002,
+    0x08E6,0x2B76,0x8008,0x343B,0x0002,0x2BB7,0x08E5,0x80C7,0x0000,0x0002,0x22D2,0x341A,0x8008,0x343B,0x0002,0x11AB,
+    0x0021,0x804D,0x0000,0x0002,0x08A4,0x2B55,0x8008,0x343B,0x0002,0x2BD8,0x08E6,0x80C7,0x0000,0x0002,0x22F2,0x341A,
+    0x8008,0x343B,0x0002,0x1169,0x0020,0x804D,0x0000,0x0002,0x0062,0x2B55,0x8008,0x343B,0x0002,0x33F9,0x08E6,0x80C7,
+    0x0000,0x0001,0x2313,0x8009,0x343B,0x0001,0x0927,0x804E,0x0000,0x0002,0x0020,0x2334,0x8008,0x343B,0x0002,0x341A,
+    0x0906,0x80C7,0x0000,0x0001,0x2334,0x8009,0x343B,0x0001,0x0907,0x8013,0x0000,0x0009,0x00A4,0x09AB,0x1271,0x1B36,
+    0x1B78,0x1B78,0x12D3,0x0949,0x0021,0x8017,0x0000,0x0009,0x00A4,0x122F,0x1B36,0x1B78,0x1B78,0x12D3,0x1270,0x09CD,
+    0x0084,0x8013,0x0000,0x0001,0x2334,0x8009,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8009,0x343B,0x0001,
+    0x0928,0x8012,0x0000,0x0002,0x00C5,0x12D4,0x8007,0x1B78,0x0002,0x09CC,0x0042,0x8015,0x0000,0x0002,0x00E6,0x12F4,
+    0x8007,0x1B78,0x0002,0x122F,0x0063,0x8011,0x0000,0x0002,0x0021,0x2334,0x8009,0x343B,0x0001,0x0906,0x80C7,0x0000,
+    0x0001,0x2334,0x8009,0x343B,0x0001,0x1148,0x8009,0x0000,0x0005,0x0042,0x08C5,0x1169,0x11EC,0x0083,0x8004,0x0000,
+    0x0002,0x0949,0x1AF5,0x8008,0x1B78,0x0002,0x0949,0x0021,0x8013,0x0000,0x0002,0x0083,0x12B3,0x8008,0x1B78,0x0002,
+    0x122F,0x0063,0x8004,0x0000,0x0004,0x118A,0x11AA,0x0907,0x0083,0x8009,0x0000,0x0002,0x0042,0x2335,0x8009,0x343B,
+    0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8009,0x343B,0x000B,0x1169,0x0020,0x0000,0x0041,0x0907,0x11AB,0x1A4E,
+    0x22D2,0x2B56,0x33F9,0x343A,0x8003,0x343B,0x0002,0x1A6F,0x0063,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8008,0x1B78,
+    0x0002,0x1292,0x0084,0x8013,0x0000,0x0002,0x098B,0x1B15,0x8008,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,
+    0x1148,0x2B97,0x8003,0x343B,0x000B,0x341A,0x2BB7,0x2314,0x1A90,0x19ED,0x1169,0x08A4,0x0020,0x0000,0x0063,0x2B55,
+    0x8009,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8009,0x343B,0x0004,0x118A,0x0021,0x1A0D,0x2BD8,0x800A,
+    0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0002,
+    0x1271,0x1B57,0x8008,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800A,0x343B,0x0004,0x2B76,
+    0x0907,0x08A4,0x2B55,0x8009,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8009,0x343B,0x0003,0x11AB,0x1A4F,
+    0x2BD8,0x800B,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,
+    0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800B,0x343B,0x0003,
+    0x22D2,0x1148,0x2B55,0x8009,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8009,0x343B,0x0002,0x1A90,0x2BB7,
+    0x800C,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,
+    0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800C,0x343B,0x0002,0x2334,
+    0x2BD9,0x8009,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,
+    0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,
+    0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800C,0x343B,0x0001,0x343A,0x800A,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,
+    0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,
+    0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,
+    0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,
+    0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,
+    0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,
+    0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,
+    0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,
+    0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,
+    0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,
+    0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,
+    0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,
+    0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,
+    0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,
+    0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,
+    0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,
+    0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,
+    0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,
+    0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,
+    0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,
+    0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,
+    0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,
+    0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,
+    0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,
+    0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,
+    0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,
+    0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,
+    0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,
+    0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,
+    0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,
+    0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,
+    0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,
+    0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,
+    0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,
+    0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,
+    0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,
+    0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,
+    0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,
+    0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,
+    0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,
+    0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,
+    0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0001,0x2334,0x8017,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,
+    0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,
+    0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8017,0x343B,0x0001,0x0906,0x80C7,0x0000,0x0002,0x22B1,0x341A,0x8016,0x343B,
+    0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,
+    0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8016,0x343B,0x0002,0x2BB8,0x08E5,0x80C7,
+    0x0000,0x0002,0x1A2E,0x2BD9,0x8016,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,
+    0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,
+    0x8016,0x343B,0x0002,0x2334,0x08A4,0x80C7,0x0000,0x0002,0x08C5,0x2B76,0x8016,0x343B,0x0002,0x1A90,0x0083,0x8003,
+    0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,
+    0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8016,0x343B,0x0002,0x1169,0x0020,0x80C8,0x0000,0x0003,0x08E6,0x2334,
+    0x341A,0x8014,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,
+    0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x8014,0x343B,0x0003,
+    0x2BB7,0x1169,0x0021,0x80CA,0x0000,0x0004,0x0021,0x1148,0x1A6F,0x2313,0x8004,0x2334,0x0001,0x33F9,0x800D,0x343B,
+    0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,
+    0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x2B76,0x8004,0x2334,
+    0x0003,0x22D2,0x19EC,0x0083,0x80D4,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,
+    0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,
+    0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,
+    0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,
+    0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0001,0x2334,
+    0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,
+    0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,
+    0x80DB,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,
+    0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,
+    0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,
+    0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,
+    0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,
+    0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,
+    0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0001,0x2334,
+    0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,
+    0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,
+    0x80DB,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,
+    0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,
+    0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,
+    0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,
+    0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,
+    0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,
+    0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0001,0x2334,
+    0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,
+    0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800D,0x343B,0x0001,0x0906,
+    0x80DB,0x0000,0x0001,0x2334,0x800D,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,
+    0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,
+    0x800D,0x343B,0x0001,0x0906,0x80DB,0x0000,0x0002,0x22D2,0x341A,0x800C,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,
+    0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,
+    0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800C,0x343B,0x0002,0x33F9,0x08E6,0x80DB,0x0000,0x0002,0x1A6F,0x33F9,0x800C,
+    0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,
+    0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800C,0x343B,0x0002,0x2B76,0x08C5,
+    0x80DB,0x0000,0x0002,0x0948,0x2B97,0x800C,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,
+    0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,
+    0x2BB7,0x800C,0x343B,0x0002,0x1A0D,0x0042,0x80DC,0x0000,0x0002,0x1A0D,0x2BD8,0x800B,0x343B,0x0002,0x1A90,0x0083,
+    0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8009,0x1B78,0x0001,0x00C6,0x8013,0x0000,0x0001,0x1292,0x8009,0x1B78,0x0002,
+    0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,0x800B,0x343B,0x0002,0x1A90,0x0083,0x80DE,0x0000,0x0003,0x11CC,
+    0x2B97,0x341A,0x8009,0x343B,0x0002,0x1A90,0x0083,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8008,0x1B78,0x0002,0x1B57,
+    0x00C5,0x8013,0x0000,0x0002,0x1271,0x1B57,0x8008,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0002,0x118A,0x2BB7,
+    0x8009,0x343B,0x0003,0x2BD9,0x1A70,0x0083,0x80E0,0x0000,0x000D,0x0062,0x0907,0x11AA,0x1A0D,0x1A70,0x22F2,0x2B55,
+    0x2BD8,0x341A,0x343B,0x343B,0x1A2E,0x0062,0x8003,0x0000,0x0002,0x0949,0x1AF5,0x8008,0x1B78,0x0002,0x1271,0x0083,
+    0x8013,0x0000,0x0002,0x098B,0x1B15,0x8008,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x000C,0x0927,0x2B96,0x343B,
+    0x343B,0x33F9,0x2B97,0x2314,0x22B1,0x1A4E,0x11CC,0x1169,0x08A4,0x80EA,0x0000,0x0004,0x0020,0x0083,0x08E6,0x0062,
+    0x8004,0x0000,0x0002,0x0949,0x1AF5,0x8007,0x1B78,0x0002,0x1B57,0x0927,0x8014,0x0000,0x0003,0x0042,0x1291,0x1B57,
+    0x8007,0x1B78,0x0002,0x122F,0x0063,0x8003,0x0000,0x0004,0x0021,0x08C5,0x08A4,0x0041,0x80FA,0x0000,0x0002,0x0928,
+    0x12F4,0x8006,0x1B78,0x0003,0x1B57,0x096A,0x0021,0x8015,0x0000,0x0003,0x0083,0x1292,0x1B57,0x8006,0x1B78,0x0002,
+    0x11EE,0x0062,0x8102,0x0000,0x0008,0x00C5,0x098B,0x122F,0x1291,0x1B36,0x1B16,0x1250,0x00C6,0x8018,0x0000,0x0009,
+    0x0042,0x09AC,0x12D3,0x1B57,0x12D3,0x1271,0x09ED,0x0928,0x0041,0x8D7B,0x0000,0x0004,0x5370,0x95FC,0x95DC,0x42AD,
+    0x8003,0x0000,0x0012,0x42AD,0x95DC,0x95BB,0x42AD,0x0000,0x0000,0x1905,0x7CF8,0x9E1D,0x8D9A,0x31E9,0x0000,0x0000,
+    0x1905,0x7CF8,0x9E1D,0x8D9A,0x31E9,0x8003,0x0000,0x0006,0x5BB2,0x95FC,0x9E1D,0x9E1D,0x8D9A,0x29C8,0x8003,0x0000,
+    0x0002,0x1905,0x8539,0x8003,0x9E1D,0x0002,0x74B6,0x0862,0x8004,0x0000,0x0006,0x29A8,0x8539,0x9E1D,0x9E1D,0x95FC,
+    0x63F3,0x8005,0x0000,0x0002,0x31E9,0x8D9B,0x8005,0x9E1D,0x0003,0x8DBB,0x6C34,0x1925,0x8005,0x0000,0x0006,0x4B0E,
+    0x95BB,0x9E1D,0x9E1D,0x8DBB,0x428C,0x8005,0x0000,0x0006,0x6413,0x95FD,0x9E1D,0x9E1D,0x7CD7,0x10C3,0x8003,0x0000,
+    0x0004,0x5350,0x95FC,0x95FC,0x5350,0x800C,0x0000,0x0002,0x2166,0x8559,0x8003,0x9E1D,0x0001,0x6413,0x8004,0x0000,
+    0x0006,0x5350,0x95FC,0x9E1D,0x9E1D,0x95BB,0x428C,0x8003,0x0000,0x0004,0x63F3,0x95FC,0x95FC,0x5370,0x8003,0x0000,
+    0x0004,0x63F3,0x95FC,0x95FC,0x5370,0x8003,0x0000,0x0009,0x0882,0x5BB2,0x8D9B,0x95FD,0x9E1D,0x9E1D,0x8DBB,0x5BD2,
+    0x0882,0x8003,0x0000,0x0005,0x29A8,0x8D7A,0x9E1D,0x8539,0x1925,0x8004,0x0000,0x0008,0x1925,0x6C34,0x8DBB,0x9E1D,
+    0x9E1D,0x95BB,0x7496,0x2166,0x800D,0x0000,0x0002,0x5370,0x95FC,0x8004,0x9E1D,0x0004,0x95FC,0x855A,0x5350,0x0041,
+    0x8003,0x0000,0x0004,0x31E9,0x8D9B,0x9E1D,0x6C55,0x8009,0x0000,0x0006,0x4B0E,0x95BB,0x9E1D,0x9E1D,0x8DBB,0x428C,
+    0x8003,0x0000,0x0004,0x428C,0x8D9B,0x95DC,0x534F,0x8005,0x0000,0x0006,0x63F3,0x95FC,0x855A,0x29C8,0x0862,0x7475,
+    0x8006,0x9E1D,0x0006,0x95FD,0x7475,0x0862,0x0000,0x31E9,0x8D9B,0x8005,0x9E1D,0x0003,0x8DBB,0x6C34,0x1925,0x802C,
+    0x0000,0x001E,0x10E4,0x8559,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,
+    0x4AEE,0x95FC,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x10E4,0x8559,
+    0x8004,0x9E1D,0x0001,0x6C75,0x8003,0x0000,0x0002,0x532F,0x961D,0x8003,0x9E1D,0x0002,0x95BB,0x29A8,0x8004,0x0000,
+    0x0001,0x6C75,0x8004,0x9E1D,0x0002,0x95FC,0x42AC,0x8004,0x0000,0x0001,0x63F3,0x8008,0x9E1D,0x0002,0x8D9B,0x31E9,
+    0x8003,0x0000,0x0002,0x1925,0x8D7A,0x8004,0x9E1D,0x0002,0x8559,0x1905,0x8003,0x0000,0x0002,0x1905,0x8559,0x8004,
+    0x9E1D,0x0001,0x5B91,0x8003,0x0000,0x0004,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x800C,0x0000,0x0001,0x534F,0x8004,0x9E1D,
+    0x0006,0x95BB,0x3209,0x0000,0x0000,0x10C3,0x8539,0x8004,0x9E1D,0x0013,0x6C34,0x0000,0x0000,0x2146,0x8D7A,0x9E1D,
+    0x9E1D,0x8559,0x10E4,0x0000,0x2167,0x8D9B,0x9E1D,0x9E1D,0x8559,0x10E4,0x0000,0x0000,0x74B6,0x8007,0x9E1D,0x0005,
+    0x7CD7,0x0862,0x0000,0x0000,0x63F3,0x8003,0x9E1D,0x0001,0x534F,0x8003,0x0000,0x0002,0x4B0E,0x95DC,0x8006,0x9E1D,
+    0x0002,0x95DC,0x42AD,0x800B,0x0000,0x0002,0x10C3,0x8539,0x8008,0x9E1D,0x0009,0x7CD7,0x0882,0x0000,0x0000,0x6C34,
+    0x9E1D,0x9E1D,0x95BB,0x29A8,0x8007,0x0000,0x0002,0x1925,0x8D7A,0x8004,0x9E1D,0x0009,0x8559,0x1905,0x0000,0x0000,
+    0x7CF7,0x9E1D,0x9E1D,0x8D9B,0x2187,0x8003,0x0000,0x0007,0x3A6B,0x95DC,0x9E1D,0x9E1D,0x6C34,0x2987,0x8DBB,0x8007,
+    0x9E1D,0x0004,0x95BB,0x29A8,0x0000,0x63F3,0x8008,0x9E1D,0x0002,0x8D9B,0x31E9,0x802B,0x0000,0x000F,0x1905,0x8559,
+    0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x42CD,0x95FC,0x9E1D,0x9E1D,0x6C75,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0004,
+    0x6C34,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0005,0x6C34,0x0000,0x0000,0x1905,0x8559,0x8004,0x9E1D,0x0005,0x8D9B,
+    0x2167,0x0000,0x0862,0x7CF8,0x8004,0x9E1D,0x0002,0x95DC,0x320A,0x8003,0x0000,0x0008,0x1925,0x8D7A,0x9E1D,0x9E1D,
+    0x95FD,0x9E1D,0x9E1D,0x6C34,0x8004,0x0000,0x0001,0x6C34,0x8009,0x9E1D,0x000C,0x8539,0x10C3,0x0000,0x0000,0x42CD,
+    0x95FC,0x9E1D,0x961D,0x961D,0x9E1D,0x95FC,0x42AC,0x8003,0x0000,0x0002,0x2146,0x8D7A,0x8004,0x9E1D,0x0008,0x8518,
+    0x0862,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x800C,0x0000,0x0001,0x5350,0x8005,0x9E1D,0x0005,0x63F3,0x0000,
+    0x0000,0x42CD,0x95FC,0x8004,0x9E1D,0x0013,0x7475,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,
+    0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x320A,0x95DC,0x8007,0x9E1D,0x0005,0x95DC,0x3A6B,0x0000,0x0000,
+    0x6C34,0x8003,0x9E1D,0x0005,0x5350,0x0000,0x0000,0x29C9,0x8DBB,0x8008,0x9E1D,0x0002,0x8D7A,0x2166,0x800A,0x0000,
+    0x0002,0x1905,0x8559,0x8009,0x9E1D,0x0008,0x63F3,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95BB,0x29C8,0x8007,0x0000,
+    0x000F,0x42CD,0x95FC,0x9E1D,0x961D,0x961D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x5370,0x961D,0x9E1D,0x9E1D,0x63F3,
+    0x8003,0x0000,0x0007,0x74B6,0x9E1D,0x9E1D,0x95DC,0x3A6B,0x29A8,0x95BB,0x8006,0x9E1D,0x0005,0x95FD,0x7475,0x0862,
+    0x0000,0x6C34,0x8009,0x9E1D,0x0002,0x8539,0x10C3,0x802A,0x0000,0x000F,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,
+    0x0000,0x74B6,0x9E1D,0x9E1D,0x95DC,0x3A6B,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0004,0x6C34,0x0000,0x0000,0x5350,
+    0x8003,0x9E1D,0x0005,0x6C34,0x0000,0x0000,0x1905,0x8559,0x8004,0x9E1D,0x0005,0x961D,0x532F,0x0000,0x3209,0x95BB,
+    0x8004,0x9E1D,0x0002,0x95FC,0x42AC,0x8003,0x0000,0x0009,0x42AC,0x95FC,0x9E1D,0x8DBB,0x63F3,0x9E1D,0x9E1D,0x8539,
+    0x10C3,0x8003,0x0000,0x0016,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x3209,0x855A,0x9E1D,0x9E1D,0x95FC,0x42AC,
+    0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x7CF7,0x7CF7,0x9E1D,0x9E1D,0x6413,0x8003,0x0000,0x0002,0x29A8,0x95BB,0x8004,
+    0x9E1D,0x0008,0x95DC,0x3A4B,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x800C,0x0000,0x0001,0x5350,0x8005,0x9E1D,
+    0x0004,0x8539,0x10C3,0x0000,0x6C75,0x8005,0x9E1D,0x001F,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,
+    0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x42AC,0x95FC,0x9E1D,0x9E1D,0x5BD2,0x0000,0x3A4B,
+    0x95DC,0x9E1D,0x9E1D,0x5BB1,0x0000,0x0000,0x6C34,0x8003,0x9E1D,0x0004,0x5350,0x0000,0x0000,0x63F3,0x8003,0x9E1D,
+    0x0004,0x7CF7,0x10C3,0x2187,0x855A,0x8003,0x9E1D,0x0001,0x5350,0x800A,0x0000,0x0013,0x1905,0x8559,0x9E1D,0x9E1D,
+    0x8559,0x1905,0x0041,0x534F,0x95DC,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8007,
+    0x0000,0x001C,0x6C34,0x9E1D,0x9E1D,0x7CF7,0x7CF7,0x9E1D,0x9E1D,0x6413,0x0000,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,
+    0x8D7A,0x2166,0x0000,0x322A,0x95DC,0x9E1D,0x9E1D,0x74B6,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x8007,0x0000,
+    0x000C,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x3209,0x855A,0x9E1D,0x9E1D,0x95FC,0x42AC,0x802A,0x0000,0x000F,
+    0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x3209,0x95BB,0x9E1D,0x9E1D,0x7CF8,0x0862,0x0000,0x0000,0x5350,0x8003,
+    0x9E1D,0x0004,0x6C34,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0014,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,
+    0x8D7A,0x95FC,0x9E1D,0x74B6,0x0000,0x5B91,0x9E1D,0x9E1D,0x8538,0x95FC,0x9E1D,0x95FC,0x42AC,0x8003,0x0000,0x0009,
+    0x6413,0x9E1D,0x9E1D,0x8518,0x3A2A,0x95DC,0x9E1D,0x95DC,0x3A4B,0x8003,0x0000,0x0027,0x6C34,0x9E1D,0x9E1D,0x95FC,
+    0x42AC,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x9E1D,0x5350,0x0000,0x10C3,0x8539,0x9E1D,0x9E1D,0x5BB1,0x5BB1,0x9E1D,
+    0x9E1D,0x8539,0x10C3,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8539,0x961D,0x9E1D,0x6413,0x0000,0x0000,0x7CF7,
+    0x9E1D,0x9E1D,0x7CF7,0x800C,0x0000,0x002E,0x5350,0x9E1D,0x9E1D,0x95DC,0x8D9B,0x9E1D,0x95DC,0x3A6B,0x1925,0x8D7A,
+    0x9E1D,0x8DBB,0x8D9A,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,
+    0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x42AD,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,
+    0x6C34,0x0000,0x0000,0x6C34,0x8003,0x9E1D,0x0004,0x5350,0x0000,0x0000,0x74B6,0x8003,0x9E1D,0x0004,0x5350,0x0000,
+    0x0000,0x63F3,0x8003,0x9E1D,0x0001,0x6C34,0x800A,0x0000,0x0013,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,
+    0x0000,0x74B6,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8006,0x0000,0x001D,0x10C3,
+    0x8539,0x9E1D,0x9E1D,0x5BB1,0x5BB1,0x9E1D,0x9E1D,0x8539,0x10C3,0x0000,0x0000,0x4AEE,0x95FC,0x9E1D,0x9E1D,0x5B91,
+    0x0000,0x6C75,0x9E1D,0x9E1D,0x95DC,0x322A,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x8007,0x0000,0x000C,0x6C34,
+    0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x9E1D,0x5350,0x802A,0x0000,0x000B,0x1905,0x8559,
+    0x9E1D,0x9E1D,0x7CF7,0x0000,0x6413,0x9E1D,0x9E1D,0x961D,0x532F,0x8003,0x0000,0x0001,0x5350,0x8003,0x9E1D,0x0004,
+    0x6C34,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0020,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7475,0x8559,
+    0x9E1D,0x8D9B,0x29A8,0x7CF7,0x9E1D,0x95DC,0x5B91,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x10C3,0x8539,0x9E1D,
+    0x9E1D,0x63F3,0x10C3,0x8539,0x9E1D,0x9E1D,0x5BB1,0x8003,0x0000,0x0008,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,
+    0x0000,0x5350,0x8003,0x9E1D,0x001C,0x5350,0x0000,0x3A4B,0x95DC,0x9E1D,0x95DC,0x3A4B,0x3A4B,0x95DC,0x9E1D,0x95DC,
+    0x320A,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x63D2,0x8D9B,0x9E1D,0x8559,0x1905,0x0000,0x7CF7,0x9E1D,0x9E1D,
+    0x7CF7,0x800C,0x0000,0x002E,0x5350,0x9E1D,0x9E1D,0x95BB,0x63F3,0x9E1D,0x9E1D,0x6413,0x42AC,0x95FC,0x9E1D,0x7475,
+    0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,
+    0x9E1D,0x8559,0x1905,0x0000,0x2187,0x8D9B,0x9E1D,0x9E1D,0x7CD7,0x0882,0x0000,0x63F3,0x95FC,0x8D9A,0x31E9,0x0000,
+    0x0000,0x6C34,0x8003,0x9E1D,0x0004,0x5350,0x0000,0x0000,0x7CF7,0x8003,0x9E1D,0x0004,0x5350,0x0000,0x0000,0x5350,
+    0x8003,0x9E1D,0x0001,0x6C75,0x800A,0x0000,0x0013,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x0000,0x7CF7,
+    0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8006,0x0000,0x000A,0x3A4B,0x95DC,0x9E1D,
+    0x95DC,0x3A4B,0x3A4B,0x95DC,0x9E1D,0x95DC,0x320A,0x8003,0x0000,0x0010,0x74B6,0x9E1D,0x9E1D,0x8D7A,0x428C,0x95BB,
+    0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x8007,0x0000,0x000C,0x6C34,0x9E1D,0x9E1D,
+    0x95FC,0x42AC,0x0000,0x0000,0x5350,0x9E1D,0x9E1D,0x961D,0x4B2F,0x802A,0x0000,0x000B,0x1905,0x8559,0x9E1D,0x9E1D,
+    0x7D18,0x31E9,0x8559,0x9E1D,0x9E1D,0x8D7A,0x1925,0x8003,0x0000,0x0001,0x5350,0x8003,0x9E1D,0x0004,0x6C34,0x0000,
+    0x0000,0x5350,0x8003,0x9E1D,0x004A,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x6C34,0x9E1D,0x961D,
+    0x63D2,0x8DBB,0x9E1D,0x7CF8,0x42CD,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x0000,0x3A4B,0x95DC,0x9E1D,0x95FC,0x42AC,
+    0x0000,0x6C34,0x9E1D,0x9E1D,0x8518,0x0862,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x3209,0x855A,
+    0x9E1D,0x9E1D,0x95FC,0x428C,0x0000,0x63F3,0x9E1D,0x9E1D,0x8559,0x1905,0x1905,0x8559,0x9E1D,0x9E1D,0x5BB1,0x0000,
+    0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x6C75,0x9E1D,0x95FC,0x42CD,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x800C,
+    0x0000,0x0027,0x5350,0x9E1D,0x9E1D,0x95BB,0x42AD,0x8DBB,0x9E1D,0x8539,0x6C75,0x9E1D,0x95FC,0x42CD,0x7CF7,0x9E1D,
+    0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,
+    0x1905,0x0000,0x0000,0x42AD,0x95DC,0x9E1D,0x9E1D,0x8559,0x3A4A,0x8006,0x0000,0x0001,0x6C34,0x8003,0x9E1D,0x0004,
+    0x5350,0x0000,0x0000,0x7CF7,0x8003,0x9E1D,0x0008,0x5350,0x0000,0x0000,0x29C8,0x8538,0x95BB,0x8D7A,0x428C,0x800A,
+    0x0000,0x0013,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x0041,0x534F,0x95DC,0x9E1D,0x9E1D,0x8559,0x10E4,0x0000,
+    0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8006,0x0000,0x000A,0x63F3,0x9E1D,0x9E1D,0x8559,0x1905,0x1905,0x8559,0x9E1D,
+    0x9E1D,0x5BB1,0x8003,0x0000,0x000D,0x322A,0x95DC,0x9E1D,0x9E1D,0x95FC,0x9E1D,0x9E1D,0x8D7A,0x2166,0x0000,0x0000,
+    0x29A8,0x95BB,0x8005,0x9E1D,0x0002,0x95DC,0x4B2F,0x8003,0x0000,0x000C,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,
+    0x3209,0x855A,0x9E1D,0x9E1D,0x8D9B,0x2987,0x802A,0x0000,0x0002,0x1905,0x8559,0x8007,0x9E1D,0x0001,0x5BB1,0x8004,
+    0x0000,0x0001,0x5350,0x8003,0x9E1D,0x0004,0x6C34,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0024,0x6C34,0x0000,0x0000,
+    0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x3A6B,0x95DC,0x9E1D,0x95FD,0x9E1D,0x9E1D,0x5B91,0x42AC,0x95FC,0x9E1D,0x95FC,
+    0x42AC,0x0000,0x0000,0x5BB1,0x9E1D,0x9E1D,0x8D7A,0x2146,0x0000,0x4AEE,0x95FC,0x9E1D,0x8DBB,0x29C8,0x0000,0x0000,
+    0x6C34,0x8009,0x9E1D,0x001D,0x8539,0x10C3,0x0862,0x8518,0x9E1D,0x9E1D,0x7475,0x0000,0x0000,0x7475,0x9E1D,0x9E1D,
+    0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x42CD,0x95FC,0x9E1D,0x7475,0x0000,0x7CF7,0x9E1D,0x9E1D,
+    0x7CF7,0x800C,0x0000,0x001F,0x5350,0x9E1D,0x9E1D,0x95BB,0x29C8,0x74B6,0x9E1D,0x9E1D,0x961D,0x9E1D,0x8D7A,0x1925,
+    0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,
+    0x9E1D,0x8559,0x1905,0x8003,0x0000,0x0002,0x3A2A,0x8D7A,0x8003,0x9E1D,0x0002,0x74B6,0x1925,0x8004,0x0000,0x0001,
+    0x6C34,0x8003,0x9E1D,0x0004,0x5350,0x0000,0x0000,0x7CF7,0x8003,0x9E1D,0x0001,0x5350,0x8011,0x0000,0x0002,0x1905,
+    0x8559,0x8009,0x9E1D,0x0008,0x63F3,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8005,0x0000,0x000B,0x0862,
+    0x8518,0x9E1D,0x9E1D,0x7475,0x0000,0x0000,0x7475,0x9E1D,0x9E1D,0x7CF7,0x8004,0x0000,0x0001,0x6C34,0x8004,0x9E1D,
+    0x0002,0x95FD,0x5350,0x8003,0x0000,0x0002,0x29A8,0x95BB,0x8006,0x9E1D,0x0001,0x7CF7,0x8003,0x0000,0x0001,0x6C34,
+    0x8008,0x9E1D,0x0002,0x95FD,0x5B70,0x802B,0x0000,0x0002,0x1905,0x8559,0x8007,0x9E1D,0x0002,0x95BB,0x428C,0x8003,
+    0x0000,0x0001,0x5350,0x8003,0x9E1D,0x0004,0x6C34,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x000A,0x6C34,0x0000,0x0000,
+    0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x10C3,0x8539,0x8003,0x9E1D,0x0017,0x95BB,0x3209,0x42AC,0x95FC,0x9E1D,0x95FC,
+    0x42AC,0x0000,0x0862,0x8518,0x9E1D,0x9E1D,0x74B6,0x0000,0x0000,0x2167,0x8D9B,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,
+    0x6C34,0x8008,0x9E1D,0x001E,0x8D9B,0x31E9,0x0000,0x320A,0x95DC,0x9E1D,0x961D,0x4B2F,0x0000,0x0000,0x4B2F,0x961D,
+    0x9E1D,0x8DBB,0x29C8,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x10C3,0x8539,0x9E1D,0x8D9B,0x2167,0x7CF7,0x9E1D,
+    0x9E1D,0x7CF7,0x800C,0x0000,0x0007,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x532F,0x961D,0x8003,0x9E1D,0x0015,0x6C75,
+    0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,
+    0x9E1D,0x9E1D,0x8559,0x1905,0x8004,0x0000,0x0007,0x0041,0x5BB1,0x95DC,0x9E1D,0x9E1D,0x95BB,0x428C,0x8003,0x0000,
+    0x0001,0x6C34,0x8003,0x9E1D,0x0004,0x5350,0x0000,0x0000,0x7CF7,0x8003,0x9E1D,0x0001,0x5350,0x8011,0x0000,0x0002,
+    0x1905,0x8559,0x8008,0x9E1D,0x0009,0x7CD7,0x0882,0x0000,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8005,0x0000,
+    0x000C,0x320A,0x95DC,0x9E1D,0x961D,0x4B2F,0x0000,0x0000,0x4B2F,0x961D,0x9E1D,0x8DBB,0x29C8,0x8003,0x0000,0x0002,
+    0x2166,0x8D7A,0x8003,0x9E1D,0x0002,0x7D18,0x0882,0x8003,0x0000,0x0002,0x29A8,0x95BB,0x8005,0x9E1D,0x0002,0x95DC,
+    0x4B2F,0x8003,0x0000,0x0001,0x6C34,0x8007,0x9E1D,0x0002,0x8D9B,0x4AEE,0x802C,0x0000,0x000F,0x1905,0x8559,0x9E1D,
+    0x9E1D,0x855A,0x5B91,0x63F2,0x95BB,0x9E1D,0x9E1D,0x8D7A,0x1925,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0004,0x6C34,
+    0x0000,0x0000,0x5350,0x8003,0x9E1D,0x000A,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x6413,
+    0x8003,0x9E1D,0x000A,0x7CF7,0x0000,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x29C8,0x8DBB,0x8009,0x9E1D,0x0004,
+    0x74B6,0x0000,0x0000,0x6C34,0x8006,0x9E1D,0x0006,0x8D9B,0x6C34,0x1925,0x0000,0x0000,0x5350,0x8009,0x9E1D,0x0011,
+    0x961D,0x4B2F,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x0000,0x6413,0x9E1D,0x961D,0x532F,0x7CF7,0x9E1D,0x9E1D,
+    0x7CF7,0x800C,0x0000,0x001F,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x2987,0x8D9B,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,
+    0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,
+    0x9E1D,0x8559,0x1905,0x8006,0x0000,0x0009,0x29A8,0x855A,0x9E1D,0x9E1D,0x8D9B,0x29C8,0x0000,0x0000,0x6C34,0x8003,
+    0x9E1D,0x0004,0x5350,0x0000,0x0000,0x7CF7,0x8003,0x9E1D,0x0008,0x5350,0x0000,0x0000,0x29C8,0x8559,0x95BB,0x8D7A,
+    0x428C,0x800A,0x0000,0x0002,0x1905,0x8559,0x8005,0x9E1D,0x0004,0x95FC,0x8539,0x5350,0x0041,0x8003,0x0000,0x0005,
+    0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8005,0x0000,0x0001,0x5350,0x8009,0x9E1D,0x0002,0x961D,0x4B2F,0x8004,0x0000,
+    0x0005,0x5BB1,0x9E1D,0x9E1D,0x95FC,0x4AEE,0x8004,0x0000,0x0005,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x8007,0x0000,
+    0x0001,0x6C34,0x8008,0x9E1D,0x0002,0x7496,0x0882,0x802B,0x0000,0x000F,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,
+    0x0000,0x5350,0x9E1D,0x9E1D,0x95FC,0x4AEE,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0004,0x6C34,0x0000,0x0000,0x5350,
+    0x8003,0x9E1D,0x0017,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x3A4B,0x95DC,0x9E1D,0x9E1D,
+    0x5350,0x0000,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x42AD,0x95FC,0x8009,0x9E1D,0x0008,0x8559,0x1905,0x0000,
+    0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8007,0x0000,0x0001,0x6C54,0x800A,0x9E1D,0x0010,0x6C34,0x0000,0x29A8,0x95BB,
+    0x9E1D,0x9E1D,0x5350,0x0000,0x320A,0x95DC,0x9E1D,0x7CF7,0x7CF8,0x9E1D,0x9E1D,0x7CF7,0x800C,0x0000,0x002E,0x5350,
+    0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x74B6,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,
+    0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x31E9,
+    0x8D9B,0x95FD,0x7475,0x0862,0x0000,0x3A6B,0x95DC,0x9E1D,0x9E1D,0x63F3,0x0000,0x0000,0x6C34,0x8003,0x9E1D,0x0004,
+    0x5350,0x0000,0x0000,0x7CF7,0x8003,0x9E1D,0x0004,0x5350,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0001,0x6C75,0x800A,
+    0x0000,0x0006,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x8008,0x0000,0x0005,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,
+    0x8005,0x0000,0x0001,0x6C54,0x800A,0x9E1D,0x0001,0x6C34,0x8004,0x0000,0x0005,0x5350,0x9E1D,0x9E1D,0x95FC,0x42AC,
+    0x8004,0x0000,0x0005,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x8007,0x0000,0x000B,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,
+    0x0000,0x5B91,0x95FD,0x9E1D,0x9E1D,0x5B91,0x802B,0x0000,0x000F,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,
+    0x42AC,0x95FC,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x5350,0x8003,0x9E1D,0x0004,0x74B6,0x0000,0x0000,0x5370,0x8003,
+    0x9E1D,0x0016,0x6C34,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x0862,0x7CD7,0x9E1D,0x8D7A,0x2166,
+    0x0000,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x5350,0x800A,0x9E1D,0x0008,0x8559,0x1905,0x0000,0x6C34,0x9E1D,
+    0x9E1D,0x95FC,0x42AC,0x8007,0x0000,0x0001,0x7CF7,0x800A,0x9E1D,0x0010,0x6C34,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,
+    0x5350,0x0000,0x0862,0x7CF8,0x9E1D,0x95DC,0x8D9B,0x9E1D,0x9E1D,0x7CF7,0x800C,0x0000,0x002E,0x5350,0x9E1D,0x9E1D,
+    0x95BB,0x29A8,0x0000,0x428C,0x95DC,0x9E1D,0x5BB1,0x0000,0x0000,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x29A8,
+    0x95BB,0x9E1D,0x9E1D,0x8D9B,0x2167,0x0000,0x29C8,0x95BB,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x63F3,0x9E1D,0x9E1D,
+    0x95BB,0x29C8,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x6C34,0x8003,0x9E1D,0x0004,0x5350,0x0000,
+    0x0000,0x7CD7,0x8003,0x9E1D,0x0004,0x5370,0x0000,0x0000,0x6C34,0x8003,0x9E1D,0x0001,0x6C34,0x800A,0x0000,0x0006,
+    0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x8008,0x0000,0x0005,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8005,0x0000,
+    0x0001,0x7CF7,0x800A,0x9E1D,0x0001,0x6C34,0x8004,0x0000,0x0005,0x5350,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8004,0x0000,
+    0x0005,0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x8007,0x0000,0x000B,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x2146,
+    0x8D7A,0x9E1D,0x9E1D,0x7CF7,0x802B,0x0000,0x0016,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x42AC,0x95FC,
+    0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,0x9E1D,0x8DBB,0x322A,0x1925,0x8539,0x8003,0x9E1D,0x001A,
+    0x63F3,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x0000,0x0000,0x0041,0x2167,0x0882,0x0000,0x0000,0x42AC,
+    0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x8003,0x0000,0x000B,0x5350,0x9E1D,0x9E1D,
+    0x8559,0x1905,0x0000,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8007,0x0000,0x0004,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x8004,
+    0x0000,0x000D,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x0000,0x29A8,0x95BB,0x9E1D,0x9E1D,0x5350,0x0000,0x0000,0x5350,0x8005,
+    0x9E1D,0x0001,0x7CF7,0x800C,0x0000,0x0009,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x0000,0x1905,0x1946,0x8003,
+    0x0000,0x000E,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x961D,0x5BB1,0x0861,0x6413,
+    0x8003,0x9E1D,0x0011,0x8539,0x10C3,0x0000,0x5350,0x9E1D,0x9E1D,0x961D,0x5BB1,0x0041,0x4AEE,0x95FC,0x9E1D,0x9E1D,
+    0x7475,0x0000,0x0000,0x6C34,0x8003,0x9E1D,0x0004,0x5350,0x0000,0x0000,0x6C34,0x8003,0x9E1D,0x0008,0x8539,0x18E4,
+    0x322A,0x8DBB,0x9E1D,0x9E1D,0x95FC,0x42CD,0x800A,0x0000,0x0006,0x1905,0x8559,0x9E1D,0x9E1D,0x8559,0x1905,0x8008,
+    0x0000,0x0005,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8005,0x0000,0x0004,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x8004,0x0000,
+    0x0004,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x8004,0x0000,0x0005,0x5350,0x9E1D,0x9E1D,0x95FC,0x42AC,0x8004,0x0000,0x0005,
+    0x29A8,0x95BB,0x9E1D,0x9E1D,0x6C34,0x8007,0x0000,0x000B,0x6C34,0x9E1D,0x9E1D,0x95FC,0x42AC,0x0000,0x1905,0x8559,
+    0x9E1D,0x9E1D,0x7CF7,0x802B,0x0000,0x0010,0x1905,0x8559,0x9E1D,0x9E1D,0x7CF7,0x0000,0x0000,0x42AC,0x95FC,0x9E1D,
+    0x9E1D,0x63D2,0x0000,0x0000,0x10C3,0x8539,0x8008,0x9E1D,0x0009,0x95DC,0x3A6B,0x0000,0x0000,0x1905,0x8559,0x9E1D,
+    0x9E1D,0x6C34,0x8007,0x0000,0x000B,0x42AC,0x95FC,0x9E1D,0x95FC,0x42AC,0x0000,0x5350,0x9E1D,0x9E1D,0x95BB,0x29A8,
+    0x8003,0x0000,0x000B,0x5350,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,0x6C34,0x9E1D,0x9E1D,0x95DC,0x3A4B,0x8007,0x0000,
+    0x0004,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x8004,0x0000,0x000E,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x0000,0x29A8,0x95BB,0x9E1D,
+    0x9E1D,0x5350,0x0000,0x0000,0x2987,0x8D9B,0x8004,0x9E1D,0x0001,0x7CF7,0x800C,0x0000,0x0005,0x5350,0x9E1D,0x9E1D,
+    0x95BB,0x29A8,0x8007,0x0000,0x0004,0x7CF7,0x9E1D,0x9E1D,0x7CF7,0x8003,0x0000,0x0001,0x6413,0x8009,0x9E1D,0x0005,
+    0x63F3,0x0000,0x0000,0x3209,0x95BB,0x8007,0x9E1D,0x0005,0x961D,0x532F,0x0000,0x0000,0x6C34,0x8003,0x9E1D,0x0005,
+    0x5350,0x0000,0x0000,0x3A6B,0x95DC,0x8008,0x9E1D,0x0002,0x7CD7,0x0882,0x800A,0x0000,0x0006,0x1905,0x8559,0x9E1D,
+    0x9E1D,0x8539,0x10C3,0x8008,0x0000,0x0001,0x6C34,0x8006,0x9E1D,0x0007,0x95FC,0x7475,0x0862,0x7CF7,0x9E1D,0x9E1D,
+    0x7CF7,0x8004,0x0000,0x0004,0x7CF7,0x9E1D,0x9E1D,0x6C34,0x8004,0x0000,0x0005,0x5350,0x9E1D,0x9E1D,0x95FC,0x42AC,
+    0x8004,0x0000,0x0002,0x29A8,0x95BB,0x8006,0x9E1D,0x0010,0x95FD,0x7475,0x0862,0x0000,0x6C34,0x9E1D,0x9E1D,0x95DC,
+    0x3A4B,0x0000,0x1905,0x8559,0x9E1D,0x9E1D,0x8538,0x0882,0x802A,0x0000,0x0011,0x10E4,0x8559,0x9E1D,0x9E1D,0x74B6,
+    0x0000,0x0000,0x428C,0x95FC,0x9E1D,0x9E1D,0x8DBB,0x2987,0x0000,0x0000,0x428C,0x95BB,0x8006,0x9E1D,0x0002,0x95FD,
+    0x5B70,0x8003,0x0000,0x0005,0x1905,0x8559,0x9E1D,0x9E1D,0x6C34,0x8007,0x0000,0x000B,0x42AC,0x95FC,0x9E1D,0x95BB,
+    0x29C8,0x0000,0x534F,0x9E1D,0x9E1D,0x8D9B,0x2167,0x8003,0x0000,0x000B,0x5350,0x9E1D,0x9E1D,0x8559,0x1905,0x0000,
+    0x63F3,0x9E1D,0x9E1D,0x95BB,0x29A8,0x8007,0x0000,0x0004,0x7CD7,0x9E1D,0x9E1D,0x74B6,0x8004,0x0000,0x000A,0x7CF7,
+    0x9E1D,0x9E1D,0x6C34,0x0000,0x1905,0x855A,0x9E1D,0x9E1D,0x5350,0x8003,0x0000,0x0001,0x6C75,0x8004,0x9E1D,0x0001,
+    0x74B6,0x800C,0x0000,0x0005,0x5350,0x9E1D,0x9E1D,0x8DBB,0x2987,0x8007,0x0000,0x0004,0x7CF7,0x9E1D,0x9E1D,0x6C54,
+    0x8003,0x0000,0x0002,0x1925,0x7D18,0x8007,0x9E1D,0x0002,0x7CD7,0x0882,0x8003,0x0000,0x0002,0x5BB2,0x95FD,0x8006,
+    0x9E1D,0x0005,0x7CD7,0x0882,0x0000,0x0000,0x63F3,0x8003,0x9E1D,0x0001,0x534F,0x8003,0x0000,0x0001,0x6C34,0x8007,
+    0x9E1D,0x0002,0x8539,0x1925,0x800B,0x0000,0x0005,0x10C3,0x8539,0x9E1D,0x9E1D,0x7CF7,0x8009,0x0000,0x0001,0x6C34,
+    0x8007,0x9E1D,0x0006,0x95BB,0x29A8,0x7CD7,0x9E1D,0x9E1D,0x74B6,0x8004,0x0000,0x0004,0x7CF7,0x9E1D,0x9E1D,0x6C34,
+    0x8004,0x0000,0x0005,0x534F,0x9E1D,0x9E1D,0x95FC,0x428C,0x8004,0x0000,0x0002,0x2987,0x8DBB,0x8007,0x9E1D,0x000B,
+    0x95BB,0x29A8,0x0000,0x63F3,0x9E1D,0x9E1D,0x95BB,0x29A8,0x0000,0x10E4,0x8559,0x8003,0x9E1D,0x0001,0x534F,0x802B,
+    0x0000,0x000C,0x5370,0x95FC,0x95DC,0x42AD,0x0000,0x0000,0x0882,0x7495,0x95FD,0x9E1D,0x7475,0x0862,0x8003,0x0000,
+    0x0008,0x1925,0x6C75,0x8DBB,0x9E1D,0x9E1D,0x95FC,0x7CF7,0x3A4A,0x8005,0x0000,0x0004,0x6C34,0x9E1D,0x95DC,0x428C,
+    0x8007,0x0000,0x000A,0x2187,0x8D7A,0x9E1D,0x7D18,0x10C3,0x0000,0x29C8,0x8D7A,0x9E1D,0x6C55,0x8004,0x0000,0x000B,
+    0x29C8,0x8D9A,0x9E1D,0x6C34,0x0000,0x0000,0x31E9,0x8D9B,0x9E1D,0x74B6,0x0862,0x8007,0x0000,0x0004,0x5350,0x95FC,
+    0x95DC,0x4AEE,0x8004,0x0000,0x000A,0x5350,0x95FC,0x95DC,0x42AD,0x0000,0x0862,0x74B6,0x9E1D,0x95BB,0x3A4B,0x8003,
+    0x0000,0x0006,0x29A8,0x8559,0x9E1D,0x9E1D,0x95DC,0x42AD,0x800C,0x0000,0x0005,0x31E9,0x8D9B,0x9E1D,0x74B6,0x0862,
+    0x8007,0x0000,0x0004,0x63D2,0x95FD,0x95FC,0x4B0E,0x8004,0x0000,0x0009,0x0041,0x5B70,0x8D7A,0x95FD,0x9E1D,0x95FD,
+    0x8D7A,0x5350,0x0041,0x8005,0x0000,0x0008,0x42AD,0x8539,0x95FD,0x9E1D,0x95FD,0x8D7A,0x5350,0x0041,0x8003,0x0000,
+    0x0005,0x29A8,0x8D7A,0x9E1D,0x8539,0x1925,0x8004,0x0000,0x0008,0x3A4B,0x8539,0x95FC,0x9E1D,0x95FD,0x8D7A,0x5B70,
+    0x0041,0x800D,0x0000,0x0004,0x5370,0x95FC,0x95FC,0x5350,0x8009,0x0000,0x0002,0x42AD,0x8DBB,0x8005,0x9E1D,0x0007,
+    0x95FC,0x7475,0x0862,0x5350,0x95FC,0x95DC,0x4AEE,0x8004,0x0000,0x0004,0x5350,0x95FC,0x95DC,0x42AD,0x8004,0x0000,
+    0x0005,0x1925,0x8539,0x9E1D,0x7CD7,0x0882,0x8004,0x0000,0x0002,0x0862,0x7475,0x8006,0x9E1D,0x0010,0x95FC,0x7475,
+    0x0862,0x0000,0x31E9,0x8D9B,0x9E1D,0x74B6,0x0862,0x0000,0x0000,0x4AEE,0x8D9B,0x9E1D,0x855A,0x29C8,0x8CF9,0x0000,
 };
+// 12964 bytes (raw 90004 bytes)
+
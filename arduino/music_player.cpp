@@ -25,6 +25,46 @@ static void readString(File& f, char *buf)
     buf[len] = '\0';
 }
 
+// 先頭バイトに続くフォントごとのシグネチャを読み込み、組み込んだフォントと同じなら true
+//  (違っていれば分解済みのグリフは読み飛ばし、描画時に文字列から分解する)
+static bool readGlyphSignatures(File& f)
+{
+    bool match = true;
+    for( int n = 0 ; n < PLAYDATA_NUM_FONTS ; n++ )
+    {
+        uint32_t signature;
+        if( (f.read((uint8_t *)&signature, 4) != 4) || !GlyphRun::matchFontSignature(n, signature) )
+        {
+            match = false;
+        }
+    }
+    if( !match )
+    {
+        Serial.println("glyph data does not match the fonts");
+    }
+    return match;
+}
+
+// 文字列に続く分解済みのグリフを読み込む(use が false なら読み飛ばす)
+//  文字数(1byte), 文字コード(2byte × 文字数), フォントごとの GlyphRun
+static void readGlyphRuns(File& f, GlyphRun *runs, bool use)
+{
+    uint16_t codes[256];
+    uint8_t count;
+    bool ok = (f.read(&count, 1) == 1) && (f.read((uint8_t *)codes, count * 2) == count * 2);
+    for( int n = 0 ; n < PLAYDATA_NUM_FONTS ; n++ )
+    {
+        ok = ok && runs[n].load(f, codes, count);
+    }
+    if( !ok || !use )
+    {
+        for( int n = 0 ; n < PLAYDATA_NUM_FONTS ; n++ )
+        {
+            runs[n].clear();
+        }
+    }
+}
+
 //==============================================================================
 //   ArtistList
 //==============================================================================
@@ -42,11 +82,14 @@ bool ArtistList::load(ArtistList::LOADING_CALLBACK callback, void *context)
         return false;
     }
 
-    this->m_numArtists = (uint16_t)readByte(f);
+    uint8_t header = readByte(f);
+    bool glyphs = (header & PLAYDATA_GLYPHS)? true : false;
+    bool useGlyphs = glyphs && readGlyphSignatures(f);
+    this->m_numArtists = (uint16_t)(header & ~PLAYDATA_GLYPHS);
     for( uint16_t n = 0 ; n < this->m_numArtists ; n++ )
     {
         this->m_artists[n] = new Artist();
-        this->m_artists[n]->load(f);
+        this->m_artists[n]->load(f, glyphs, useGlyphs);
     }
     f.close();
 
@@ -134,16 +177,20 @@ Artist::Artist()
 }
 
 //------------------------------------------------------------------------------
-void Artist::load(File& f)
+void Artist::load(File& f, bool glyphs, bool useGlyphs)
 {
     this->m_id = readWord(f);
     readString(f, this->m_folderName);
     readString(f, this->m_name);
+    if( glyphs )
+    {
+        readGlyphRuns(f, this->m_nameRuns, useGlyphs);
+    }
     this->m_numAlbums = (uint16_t)readByte(f);
     for( uint16_t n = 0 ; n < this->m_numAlbums ; n++ )
     {
         this->m_albums[n] = new Album(this);
-        this->m_albums[n]->load(f);
+        this->m_albums[n]->load(f, glyphs, useGlyphs);
     }
 }
 
@@ -170,11 +217,15 @@ Album::Album(Artist *artist) : m_artist(artist)
 }
 
 //------------------------------------------------------------------------------
-void Album::load(File& f)
+void Album::load(File& f, bool glyphs, bool useGlyphs)
 {
     this->m_id = readWord(f);
     readString(f, this->m_folderName);
     readString(f, this->m_title);
+    if( glyphs )
+    {
+        readGlyphRuns(f, this->m_titleRuns, useGlyphs);
+    }
     this->m_year = readWord(f);
     this->m_numTracks = readByte(f);
     this->m_totalTime = readWord(f);
@@ -203,6 +254,9 @@ PlayList::PlayList() : m_album(nullptr)
 void PlayList::load(Album *album)
 {
     char path[32]; // '/xxxxxxxx/xxxxxxxx/album.bin' 1+8+1+8+1+9+1
+#ifdef HX8357_STATS
+    uint32_t t = micros();
+#endif
     this->m_album = album;
     this->m_album->getDirectory(path);
     strcat(path, "/album.bin");
@@ -213,7 +267,9 @@ void PlayList::load(Album *album)
         Serial.println(path);
         while(1){}
     }
-    this->m_codec = readByte(f);
+    uint8_t header = readByte(f);
+    this->m_codec = header & ~(PLAYDATA_GLYPHS | PLAYDATA_COVER_COMPRESSED);
+    bool useGlyphs = (header & PLAYDATA_GLYPHS) && readGlyphSignatures(f);
     this->m_numSongs = (uint16_t)readByte(f);
     for( uint16_t n = 0 ; n < this->m_numSongs ; n++ )
     {
@@ -222,8 +278,33 @@ void PlayList::load(Album *album)
         this->m_bitRate[n] = readWord(f);
         this->m_sampleRate[n] = readWord(f);
         readString(f, this->m_titles[n]);
+        if( header & PLAYDATA_GLYPHS )
+        {
+            readGlyphRuns(f, this->m_titleRuns[n], useGlyphs);
+        }
+        else
+        {
+            this->m_titleRuns[n][0].clear();
+            this->m_titleRuns[n][1].clear();
+        }
+    }
+#ifdef HX8357_STATS
+    uint32_t imageStart = f.position();
+#endif
+    if( header & PLAYDATA_COVER_COMPRESSED )
+    {
+        this->m_image->loadCompressed(f);
+    }
+    else
+    {
+        this->m_image->load(f);
     }
-    this->m_image->load(f);
+#ifdef HX8357_STATS
+    // アルバムを切り替えるたびに SD カードから読んだバイト数と時間を表示する
+    t = micros() - t;
+    Serial.printf("[album] %luus read %lu bytes (cover %lu bytes)\n", (unsigned long)t,
+        (unsigned long)f.position(), (unsigned long)(f.position() - imageStart));
+#endif
     f.close();
 }
 
@@ -436,6 +517,18 @@ const char *MusicPlayer::getCurrentSongTitle()
     return nullptr;
 }
 
+// -----------------------------------------------------------------------------
+//   現在演奏中の曲のタイトル(分解済み)を返す。停止中やデータがなければnullptrを返す。
+// -----------------------------------------------------------------------------
+const GlyphRun *MusicPlayer::getCurrentSongTitleRun(int font)
+{
+    if( this->m_playing )
+    {
+        return this->m_playList->getTitleRun(this->m_currentSongIndex, font);
+    }
+    return nullptr;
+}
+
 uint16_t MusicPlayer::getCurrentSongLength()
 {
     if( this->m_playing )
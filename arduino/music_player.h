@@ -11,6 +11,16 @@
 
 #include "display.h"
 
+// playdata.bin・album.bin の先頭バイトの最上位ビットが立っている場合、
+// 先頭バイトの直後にフォントごとのシグネチャ(4byte, Font::getSignature() と照合する)、
+// 文字列ごとに分解済みのグリフ(GlyphRun)が続く
+// GlyphRun はフォントごとに２つ(0: 17px = Graphics::SMALL_FONT, 1: 20px = Graphics::LARGE_FONT)
+enum{PLAYDATA_GLYPHS = 0x80};
+enum{PLAYDATA_NUM_FONTS = 2};
+// album.bin の先頭バイトのこのビットが立っている場合、アルバム画像は圧縮されている
+// (Bitmap::loadCompressed を参照)
+enum{PLAYDATA_COVER_COMPRESSED = 0x40};
+
 //------------------------------------------------------------------------------
 class Artist;
 class Album
@@ -26,12 +36,14 @@ class Album
         uint16_t m_totalTime;              // 総演奏時間（各曲の演奏時間の総和）
         uint16_t m_year;                   // アルバムの発売年（西暦）
         char     m_folderName[10];         // フォルダ名
+        GlyphRun m_titleRuns[PLAYDATA_NUM_FONTS];
     public:
         Album(Artist *artist);
-        void load(File& f);
+        void load(File& f, bool glyphs=false, bool useGlyphs=false);
         uint16_t getID(){ return this->m_id; }
         Artist *getArtist(){ return this->m_artist; }
         const char *getTitle(){ return this->m_title; }
+        const GlyphRun *getTitleRun(int font){ return this->m_titleRuns[font].getCount()? &this->m_titleRuns[font] : nullptr; }
         const char *getFolderName(){ return this->m_folderName;}
         void getDirectory(char *buffer);
         uint16_t getNumTracks(){ return this->m_numTracks; }
@@ -51,11 +63,13 @@ class Artist
         uint16_t m_numAlbums;
         Album   *m_albums[MAX_ALBUM_COUNT];     // アルバムのリスト
         char     m_name[MAX_NAME_BYTES];        // アーティスト名
+        GlyphRun m_nameRuns[PLAYDATA_NUM_FONTS];
     public:
         Artist();
-        void load(File& f);
+        void load(File& f, bool glyphs=false, bool useGlyphs=false);
         uint16_t getID(){ return this->m_id; }
         const char *getName(){ return this->m_name; }
+        const GlyphRun *getNameRun(int font){ return this->m_nameRuns[font].getCount()? &this->m_nameRuns[font] : nullptr; }
         const char *getFolderName(){ return this->m_folderName; }
         uint16_t getNumAlbums(){ return this->m_numAlbums; }
         Album *getAlbum(int index){ return this->m_albums[index]; }
@@ -99,6 +113,7 @@ class PlayList
         uint16_t m_bitRate[MAX_SONG_COUNT];                     // 各曲のビットレート(kbps単位)(320など)
         uint16_t m_sampleRate[MAX_SONG_COUNT];                  // 各曲のサンプルレート(100Hz単位)(441など)
         uint8_t  m_codec;                                       // コーデック種別(MP3/AAC)
+        GlyphRun m_titleRuns[MAX_SONG_COUNT][PLAYDATA_NUM_FONTS];   // 各曲のタイトル(分解済み)
         Bitmap  *m_image;                                       // アルバム画像
     public:
         PlayList();
@@ -106,6 +121,7 @@ class PlayList
         Album *getAlbum(){ return this->m_album; }
         uint16_t getNumSongs(){ return this->m_numSongs; }
         const char *getTitle(int index){ return this->m_titles[index]; }
+        const GlyphRun *getTitleRun(int index, int font){ return this->m_titleRuns[index][font].getCount()? &this->m_titleRuns[index][font] : nullptr; }
         uint16_t getDuration(int index){ return this->m_durations[index]; }
         uint16_t getBitRate(int index){ return this->m_bitRate[index]; }
         uint16_t getSampleRate(int index){ return this->m_sampleRate[index]; }
@@ -197,6 +213,7 @@ class MusicPlayer
         PlayList *getPlayList(){ return this->m_playList; }
         uint16_t  getCurrentTrackNumber();
         const char *getCurrentSongTitle();
+        const GlyphRun *getCurrentSongTitleRun(int font);
         uint16_t  getCurrentSongLength();
         uint16_t  getCurrentBitRate();
         uint16_t  getCurrentSampleRate();
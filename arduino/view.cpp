@@ -3,8 +3,23 @@
 #include <W25Q64.h>
 #include "view.h"
 #include "display.h"
+
+// フォントをファイルから読み込む場合はどちらかを有効にする(font2bin.py で作成した .fnt を使う)
+//  FONT_FROM_SD    : SD カードの /fonts から読む
+//  FONT_FROM_FLASH : W25Q64 から読む(SD カードの /fonts のファイルと違っていれば書き直す)
+// #define FONT_FROM_SD
+// #define FONT_FROM_FLASH
+
+#if !defined(FONT_FROM_SD) && !defined(FONT_FROM_FLASH)
 #include "font_17aa.h"
 #include "font_20aa.h"
+#ifndef FONT_17AA_BITS
+#define FONT_17AA_BITS  8   // bmpfont.py がビット数を出力する前のヘッダ
+#endif
+#ifndef FONT_20AA_BITS
+#define FONT_20AA_BITS  8
+#endif
+#endif
 #include "digits.h"
 #include "icon.h"
 #include "music_player.h"
@@ -68,32 +83,102 @@ void TouchManager::execute(UIWidget *listener)
 //  Graphics
 // =============================================================================
 Font *Graphics::m_font[2] = {nullptr, nullptr};
+Rect  Graphics::m_clipStack[Graphics::MAX_CLIP_DEPTH];
+int   Graphics::m_clipDepth = 0;
+
+#if defined(FONT_FROM_SD) || defined(FONT_FROM_FLASH)
+static const char * const s_fontPaths[2] = {"/fonts/font17.fnt", "/fonts/font20.fnt"};
+#endif
 
 Graphics::Graphics(HX8357 *display, Rect rc) : m_display(display), m_clipRect(rc),
-    m_fillColor(COLOR_BLACK), m_strokeColor(COLOR_WHITE), m_fontColor(COLOR_WHITE)
+    m_fontIndex(Graphics::SMALL_FONT), m_fillColor(COLOR_BLACK), m_strokeColor(COLOR_WHITE), m_fontColor(COLOR_WHITE)
 {
     Serial.println("Graphics +");
     if( Graphics::m_font[0] == nullptr )
     {
-        Graphics::m_font[Graphics::SMALL_FONT] = new Font(17, FONT_17AA, FONTMAP_17AA);
-        Graphics::m_font[Graphics::LARGE_FONT] = new Font(20, FONT_20AA, FONTMAP_20AA);
+#if defined(FONT_FROM_FLASH)
+        // SD カードのフォントファイルが書き込み済みのものと違っていれば書き直す
+        FlashFontFile::install(s_fontPaths, 2);
+        Graphics::m_font[Graphics::SMALL_FONT] = new Font(new FlashFontFile(Graphics::SMALL_FONT));
+        Graphics::m_font[Graphics::LARGE_FONT] = new Font(new FlashFontFile(Graphics::LARGE_FONT));
+#elif defined(FONT_FROM_SD)
+        Graphics::m_font[Graphics::SMALL_FONT] = new Font(new SDFontFile(s_fontPaths[Graphics::SMALL_FONT]));
+        Graphics::m_font[Graphics::LARGE_FONT] = new Font(new SDFontFile(s_fontPaths[Graphics::LARGE_FONT]));
+#else
+        Graphics::m_font[Graphics::SMALL_FONT] = new Font(17, FONT_17AA, FONTMAP_17AA, FONT_17AA_BITS,
+            sizeof(FONT_17AA), sizeof(FONTMAP_17AA) / 4);
+        Graphics::m_font[Graphics::LARGE_FONT] = new Font(20, FONT_20AA, FONTMAP_20AA, FONT_20AA_BITS,
+            sizeof(FONT_20AA), sizeof(FONTMAP_20AA) / 4);
+#endif
+        // playdata.bin などの分解済みグリフはこのフォントで作ったものだけを使う
+        GlyphRun::setFontSignature(Graphics::SMALL_FONT, Graphics::m_font[Graphics::SMALL_FONT]->getSignature());
+        GlyphRun::setFontSignature(Graphics::LARGE_FONT, Graphics::m_font[Graphics::LARGE_FONT]->getSignature());
     }
     Serial.println("Graphics -");
 }
 
+// 描画を始める(以降の描画はクライアント領域の外にはみ出さない)
 void Graphics::beginPaint()
 {
-    // this->m_display->setClipRect(this->m_clipRect.left, this->m_clipRect.top, this->m_clipRect.width, this->m_clipRect.height);
+#ifdef SHADOW_FRAME
+    DisplayList::begin();   // refresh() の外で描画する部品もシャドウフレームに描く
+#endif
+    this->pushClip(Rect(0, 0, this->m_clipRect.width, this->m_clipRect.height));
 }
 
 void Graphics::endPaint()
 {
-    // this->m_display->setClipRect();
+    this->popClip();
+#ifdef SHADOW_FRAME
+    DisplayList::end();
+#endif
+}
+
+// クライアント座標の矩形 rc と現在のクリップ範囲の重なりを新しいクリップ範囲にする
+// (MAX_CLIP_DEPTH を超えて積んだ分は範囲を狭めない)
+void Graphics::pushClip(Rect rc)
+{
+    rc = this->toScreenCoord(rc);
+    Rect current = Graphics::getClip();
+    int16_t x0 = max(rc.left, current.left);
+    int16_t y0 = max(rc.top, current.top);
+    int16_t x1 = min((int16_t)(rc.left+rc.width), (int16_t)(current.left+current.width));
+    int16_t y1 = min((int16_t)(rc.top+rc.height), (int16_t)(current.top+current.height));
+    if( Graphics::m_clipDepth < Graphics::MAX_CLIP_DEPTH )
+    {
+        Graphics::m_clipStack[Graphics::m_clipDepth] = Rect(x0, y0, max((int16_t)(x1 - x0), (int16_t)0), max((int16_t)(y1 - y0), (int16_t)0));
+    }
+    Graphics::m_clipDepth++;
+    current = Graphics::getClip();
+    this->m_display->setClipRect(current.left, current.top, current.width, current.height);
+}
+
+// 直前の pushClip() の前のクリップ範囲に戻す
+void Graphics::popClip()
+{
+    if( Graphics::m_clipDepth > 0 )
+    {
+        Graphics::m_clipDepth--;
+    }
+    Rect current = Graphics::getClip();
+    this->m_display->setClipRect(current.left, current.top, current.width, current.height);
+}
+
+// 現在のクリップ範囲(画面座標)
+Rect Graphics::getClip()
+{
+    if( Graphics::m_clipDepth == 0 )
+    {
+        return Rect(0, 0, Graphics::SCREEN_WIDTH, Graphics::SCREEN_HEIGHT);
+    }
+    return Graphics::m_clipStack[min(Graphics::m_clipDepth, (int)Graphics::MAX_CLIP_DEPTH) - 1];
 }
 
+// クライアント領域全体を塗りつぶす
+// (m_clipRect は画面座標なので、そのまま fillRect() に渡すと位置が二重にずれる)
 void Graphics::clear()
 {
-    this->fillRect(this->m_clipRect);
+    this->fillRect(Rect(0, 0, this->m_clipRect.width, this->m_clipRect.height));
 }
 
 void Graphics::fillRect(int16_t left, int16_t top, int16_t width, int16_t height)
@@ -103,8 +188,18 @@ void Graphics::fillRect(int16_t left, int16_t top, int16_t width, int16_t height
 
 void Graphics::fillRect(Rect rc)
 {
-    rc = this->toScreenCoord(rc);
-    this->m_display->fillRect(rc.left, rc.top, rc.width, rc.height, this->m_fillColor);
+    this->fillScreenRect(this->toScreenCoord(rc), this->m_fillColor);
+}
+
+// 画面座標で塗りつぶす(記録中ならディスプレイリストに追加する)
+void Graphics::fillScreenRect(Rect rc, uint16_t color)
+{
+    if( DisplayList::isRecording() )
+    {
+        DisplayList::fillRect(this->m_display, rc, color);
+        return;
+    }
+    this->m_display->fillRect(rc.left, rc.top, rc.width, rc.height, color);
 }
 
 void Graphics::drawRect(int16_t left, int16_t top, int16_t width, int16_t height)
@@ -115,19 +210,31 @@ void Graphics::drawRect(int16_t left, int16_t top, int16_t width, int16_t height
 void Graphics::drawRect(Rect rc)
 {
     rc = this->toScreenCoord(rc);
+    if( DisplayList::isRecording() )
+    {
+        if( rc.isEmpty() )
+        {
+            return;
+        }
+        this->fillScreenRect(Rect(rc.left, rc.top, rc.width, 1), this->m_strokeColor);
+        this->fillScreenRect(Rect(rc.left, rc.top+rc.height-1, rc.width, 1), this->m_strokeColor);
+        this->fillScreenRect(Rect(rc.left, rc.top, 1, rc.height), this->m_strokeColor);
+        this->fillScreenRect(Rect(rc.left+rc.width-1, rc.top, 1, rc.height), this->m_strokeColor);
+        return;
+    }
     this->m_display->drawRect(rc.left, rc.top, rc.width, rc.height, this->m_strokeColor);
 }
 
 void Graphics::drawHzLine(int16_t x, int16_t y, int16_t length)
 {
     Point pt = this->toScreenCoord(Point(x, y));
-    this->m_display->drawFastHLine(pt.x, pt.y, length, this->m_strokeColor);
+    this->fillScreenRect(Rect(pt.x, pt.y, length, 1), this->m_strokeColor);
 }
 
 void Graphics::drawVtLine(int16_t x, int16_t y, int16_t length)
 {
     Point pt = this->toScreenCoord(Point(x, y));
-    this->m_display->drawFastVLine(pt.x, pt.y, length, this->m_strokeColor);
+    this->fillScreenRect(Rect(pt.x, pt.y, 1, length), this->m_strokeColor);
 }
 
 // void Graphics::drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2)
@@ -139,9 +246,22 @@ void Graphics::drawVtLine(int16_t x, int16_t y, int16_t length)
 
 void Graphics::drawText(int16_t x, int16_t y, const char *text, uint8_t alignment)
 {
-    Point pt = this->toScreenCoord(Point(x, y));
     Font *font = Graphics::m_font[this->m_fontIndex];
-    int16_t len = font->getTextWidth(text);
+    Point pt = this->alignText(this->toScreenCoord(Point(x, y)), font, font->getTextWidth(text), alignment);
+    this->drawString(font, pt.x, pt.y, text);
+}
+
+// 分解済みの文字列を現在のフォントで描画する
+void Graphics::drawText(int16_t x, int16_t y, const GlyphRun *run, uint8_t alignment)
+{
+    Font *font = Graphics::m_font[this->m_fontIndex];
+    Point pt = this->alignText(this->toScreenCoord(Point(x, y)), font, run->getWidth(), alignment);
+    this->drawScreenRun(font, pt.x, pt.y, run, 0, run->getCount(), run->getWidth());
+}
+
+// 画面座標の点 pt を基準に幅 len の文字列を配置したときの左上の座標
+Point Graphics::alignText(Point pt, Font *font, int16_t len, uint8_t alignment)
+{
     switch( alignment & Graphics::HZALIGN_MASK )
     {
         case Graphics::ALIGN_CENTER:
@@ -160,14 +280,62 @@ void Graphics::drawText(int16_t x, int16_t y, const char *text, uint8_t alignmen
             pt.y = pt.y - font->getHeight();
             break;
     }
-    font->drawString(this->m_display, pt.x, pt.y, text, this->m_fontColor, this->m_fillColor);
+    return pt;
 }
 
 void Graphics::drawText(Rect rc, const char *text, uint8_t alignment)
 {
-    rc = this->toScreenCoord(rc);
     Font *font = Graphics::m_font[this->m_fontIndex];
-    int16_t len = font->getTextWidth(text);
+    Point pt = this->alignText(this->toScreenCoord(rc), font, font->getTextWidth(text), alignment);
+    this->drawString(font, pt.x, pt.y, text);
+}
+
+// 分解済みの文字列を描画する(フォントは分解したときのもの)
+void Graphics::drawText(Rect rc, const GlyphRun *run, uint8_t alignment)
+{
+    Font *font = run->getFont();
+    if( !font )
+    {
+        return;
+    }
+    Point pt = this->alignText(this->toScreenCoord(rc), font, run->getWidth(), alignment);
+    this->drawScreenRun(font, pt.x, pt.y, run, 0, run->getCount(), run->getWidth());
+}
+
+// 分解済みの文字列の first 番目から last 番目の手前までのグリフを (x, y) から描画する
+void Graphics::drawRun(int16_t x, int16_t y, const GlyphRun *run, uint16_t first, uint16_t last)
+{
+    Font *font = run->getFont()? run->getFont() : Graphics::m_font[this->m_fontIndex];
+    last = min(last, run->getCount());
+    int16_t width = 0;
+    for( uint16_t n = first ; n < last ; n++ )
+    {
+        width += run->getGlyphWidth(n);
+    }
+    Point pt = this->toScreenCoord(Point(x, y));
+    this->drawScreenRun(font, pt.x, pt.y, run, first, last, width);
+}
+
+// 画面座標で分解済みの文字列を描画する(記録中ならディスプレイリストに追加する)
+void Graphics::drawScreenRun(Font *font, int16_t x, int16_t y, const GlyphRun *run, uint16_t first, uint16_t last, int16_t width)
+{
+    if( DisplayList::isRecording() )
+    {
+        DisplayList::drawRun(this->m_display, font, x, y, width, run, first, last, this->m_fontColor, this->m_fillColor);
+        return;
+    }
+    font->drawRun(this->m_display, x, y, run, this->m_fontColor, this->m_fillColor, first, last);
+}
+
+// 現在のフォントで文字列をグリフに分解する
+void Graphics::shapeText(const char *text, GlyphRun *run)
+{
+    Graphics::m_font[this->m_fontIndex]->shape(text, run);
+}
+
+// 画面座標の矩形 rc 内に幅 len の文字列を配置したときの左上の座標
+Point Graphics::alignText(Rect rc, Font *font, int16_t len, uint8_t alignment)
+{
     int16_t x, y;
     switch( alignment & Graphics::HZALIGN_MASK )
     {
@@ -193,6 +361,17 @@ void Graphics::drawText(Rect rc, const char *text, uint8_t alignment)
             y = rc.top;
             break;
     }
+    return Point(x, y);
+}
+
+// 画面座標で文字列を描画する
+void Graphics::drawString(Font *font, int16_t x, int16_t y, const char *text)
+{
+    if( DisplayList::isRecording() )
+    {
+        DisplayList::drawText(this->m_display, font, x, y, text, this->m_fontColor, this->m_fillColor);
+        return;
+    }
     font->drawString(this->m_display, x, y, text, this->m_fontColor, this->m_fillColor);
 }
 
@@ -200,19 +379,637 @@ void Graphics::drawText(Rect rc, const char *text, uint8_t alignment)
 void Graphics::drawIcon(int16_t x, int16_t y, Icon *icon, uint16_t fgcol, uint16_t bkcol)
 {
     Point pt = this->toScreenCoord(Point(x, y));
+    if( DisplayList::isRecording() )
+    {
+        DisplayList::drawIcon(this->m_display, pt.x, pt.y, icon, fgcol, bkcol);
+        return;
+    }
     icon->draw(this->m_display, pt.x, pt.y, fgcol, bkcol);
 }
 
 void Graphics::drawBitmap(int16_t x, int16_t y, Bitmap *bitmap)
+{
+    this->drawBitmap(x, y, bitmap->getWidth(), bitmap->getHeight(), bitmap->getData());
+}
+
+void Graphics::drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *image)
 {
     Point pt = this->toScreenCoord(Point(x, y));
-    bitmap->draw(this->m_display, pt.x, pt.y);
+    if( DisplayList::isRecording() )
+    {
+        DisplayList::drawBitmap(this->m_display, pt.x, pt.y, w, h, image);
+        return;
+    }
+    this->m_display->drawBitmap(pt.x, pt.y, w, h, image);
+}
+
+void Graphics::drawImage(int16_t x, int16_t y, RunLengthImage *image)
+{
+    Point pt = this->toScreenCoord(Point(x, y));
+    if( DisplayList::isRecording() )
+    {
+        DisplayList::drawImage(this->m_display, pt.x, pt.y, image);
+        return;
+    }
+    image->draw(this->m_display, pt.x, pt.y);
+}
+
+
+// =============================================================================
+//  ShadowFrame
+// =============================================================================
+#ifdef SHADOW_FRAME
+EXTMEM uint16_t ShadowFrame::m_frame[ShadowFrame::WIDTH*ShadowFrame::HEIGHT];
+EXTMEM uint16_t ShadowFrame::m_presented[ShadowFrame::WIDTH*ShadowFrame::HEIGHT];
+Rect            ShadowFrame::m_dirty;
+#ifdef HX8357_STATS
+uint32_t        ShadowFrame::m_frames = 0;
+uint32_t        ShadowFrame::m_spans = 0;
+uint32_t        ShadowFrame::m_pixels = 0;
+uint32_t        ShadowFrame::m_busBytes = 0;
+#endif
+
+// -----------------------------------------------------------------------------
+//  パネルを color で塗りつぶした直後の状態にする(EXTMEM は起動時に初期化されない)
+// -----------------------------------------------------------------------------
+void ShadowFrame::begin(uint16_t color)
+{
+    for( uint32_t n = 0 ; n < ShadowFrame::WIDTH*ShadowFrame::HEIGHT ; n++ )
+    {
+        ShadowFrame::m_frame[n] = color;
+        ShadowFrame::m_presented[n] = color;
+    }
+    ShadowFrame::m_dirty = Rect(0, 0, 0, 0);
+}
+
+// -----------------------------------------------------------------------------
+//  描画した範囲を転送の対象に加える
+// -----------------------------------------------------------------------------
+void ShadowFrame::invalidate(Rect rc)
+{
+    int16_t x0 = max(rc.left, (int16_t)0);
+    int16_t y0 = max(rc.top, (int16_t)0);
+    int16_t x1 = min((int16_t)(rc.left+rc.width), (int16_t)ShadowFrame::WIDTH);
+    int16_t y1 = min((int16_t)(rc.top+rc.height), (int16_t)ShadowFrame::HEIGHT);
+    if( (x0 >= x1) || (y0 >= y1) )
+    {
+        return;
+    }
+    Rect &dirty = ShadowFrame::m_dirty;
+    if( !dirty.isEmpty() )
+    {
+        x0 = min(x0, dirty.left);
+        y0 = min(y0, dirty.top);
+        x1 = max(x1, (int16_t)(dirty.left+dirty.width));
+        y1 = max(y1, (int16_t)(dirty.top+dirty.height));
+    }
+    dirty = Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+// -----------------------------------------------------------------------------
+//  描画した範囲を行ごとに前回の内容と比べ、変化した区間だけを転送する
+//  MERGE_GAP 以下の一致区間を挟む区間は１つにまとめる
+//  (CASET/PASET/RAMWR の 11byte より一致区間を送り直す方が安い)
+//  描画中の部品のクリップ範囲で区間が切られると m_presented とパネルが
+//  食い違うので、転送の間はクリップ範囲を画面全体にしておく
+// -----------------------------------------------------------------------------
+void ShadowFrame::present(HX8357 *display)
+{
+    Rect dirty = ShadowFrame::m_dirty;
+    if( dirty.isEmpty() )
+    {
+        return;
+    }
+#ifdef HX8357_STATS
+    uint32_t busBytes = HX8357::getStats().busBytes;
+#endif
+    display->setClipRect();
+    int16_t right = dirty.left + dirty.width;
+    for( int16_t y = dirty.top ; y < dirty.top + dirty.height ; y++ )
+    {
+        const uint16_t *frame = ShadowFrame::m_frame + y * ShadowFrame::WIDTH;
+        uint16_t *presented = ShadowFrame::m_presented + y * ShadowFrame::WIDTH;
+        int16_t x = dirty.left;
+        while( x < right )
+        {
+            while( (x < right) && (frame[x] == presented[x]) )
+            {
+                x++;
+            }
+            if( x >= right )
+            {
+                break;
+            }
+            int16_t start = x;
+            int16_t end = x;    // 変化した最後のピクセルの次
+            while( (x < right) && (x - end <= ShadowFrame::MERGE_GAP) )
+            {
+                if( frame[x] != presented[x] )
+                {
+                    end = x + 1;
+                }
+                x++;
+            }
+            display->drawBitmap(start, y, end - start, 1, frame + start);
+            memcpy(presented + start, frame + start, (end - start) * sizeof(uint16_t));
+            x = end;
+#ifdef HX8357_STATS
+            ShadowFrame::m_spans++;
+            ShadowFrame::m_pixels += end - start;
+#endif
+        }
+    }
+    ShadowFrame::m_dirty = Rect(0, 0, 0, 0);
+    Rect clip = Graphics::getClip();
+    display->setClipRect(clip.left, clip.top, clip.width, clip.height);
+#ifdef HX8357_STATS
+    ShadowFrame::m_frames++;
+    ShadowFrame::m_busBytes += HX8357::getStats().busBytes - busBytes;
+#endif
 }
 
-void Graphics::drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *image)
-{
-    Point pt = this->toScreenCoord(Point(x, y));
-    this->m_display->drawBitmap(pt.x, pt.y, w, h, image);
+#ifdef HX8357_STATS
+// -----------------------------------------------------------------------------
+void ShadowFrame::resetStats()
+{
+    ShadowFrame::m_frames = 0;
+    ShadowFrame::m_spans = 0;
+    ShadowFrame::m_pixels = 0;
+    ShadowFrame::m_busBytes = 0;
+}
+
+// -----------------------------------------------------------------------------
+//  転送１回あたりのバス転送量を表示する
+// -----------------------------------------------------------------------------
+void ShadowFrame::printStats(const char *label)
+{
+    uint32_t frames = max(ShadowFrame::m_frames, (uint32_t)1);
+    Serial.printf("[%s] shadow: frames=%lu spans=%lu pixels=%lu bus=%lu bytes/frame\n", label,
+        (unsigned long)ShadowFrame::m_frames, (unsigned long)ShadowFrame::m_spans,
+        (unsigned long)ShadowFrame::m_pixels, (unsigned long)(ShadowFrame::m_busBytes / frames));
+}
+#endif
+#endif
+
+
+// =============================================================================
+//  DisplayList
+// =============================================================================
+HX8357         *DisplayList::m_display = nullptr;
+DisplayList::Op DisplayList::m_ops[DisplayList::MAX_OPS];
+int             DisplayList::m_numOps = 0;
+char            DisplayList::m_textPool[DisplayList::TEXT_POOL_SIZE];
+int             DisplayList::m_textSize = 0;
+int             DisplayList::m_depth = 0;
+bool            DisplayList::m_enabled = true;
+bool            DisplayList::m_stripEnabled = true;
+DMAMEM uint16_t DisplayList::m_strip[DisplayList::STRIP_PIXELS];
+
+// -----------------------------------------------------------------------------
+//  記録を開始する(入れ子にできる。最も外側の end() で実行する)
+// -----------------------------------------------------------------------------
+void DisplayList::begin()
+{
+    DisplayList::m_depth++;
+}
+
+// -----------------------------------------------------------------------------
+void DisplayList::end()
+{
+    if( --DisplayList::m_depth == 0 )
+    {
+        DisplayList::flush();
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  命令を１つ追加する(いっぱいならそれまでの分を先に実行する)
+// -----------------------------------------------------------------------------
+DisplayList::Op *DisplayList::append(HX8357 *display, uint8_t type, Rect rc)
+{
+    if( DisplayList::m_numOps >= DisplayList::MAX_OPS )
+    {
+        DisplayList::flush();
+    }
+    DisplayList::m_display = display;
+    Op *op = &DisplayList::m_ops[DisplayList::m_numOps++];
+    op->type = type;
+    op->clip = Graphics::getClip();
+    op->removed = rc.isEmpty() || !op->clip.intersect(rc);
+    op->rc = rc;
+    op->object = nullptr;
+    op->run = nullptr;
+    op->text = 0;
+    op->last = 0;
+    op->strip = -1;
+    op->member = -1;
+    return op;
+}
+
+// -----------------------------------------------------------------------------
+void DisplayList::fillRect(HX8357 *display, Rect rc, uint16_t color)
+{
+    Op *op = DisplayList::append(display, DisplayList::OP_FILL, rc);
+    op->fgcol = color;
+    DisplayList::clipFill(op);
+}
+
+// -----------------------------------------------------------------------------
+void DisplayList::drawText(HX8357 *display, Font *font, int16_t x, int16_t y, const char *text, uint16_t fgcol, uint16_t bkcol)
+{
+    int len = strlen(text) + 1;
+    if( len > DisplayList::TEXT_POOL_SIZE )
+    {
+        DisplayList::flush();
+#ifdef SHADOW_FRAME
+        // 記録できない長さの文字列もシャドウフレームを通して描く
+        Surface frame = ShadowFrame::getSurface();
+        frame.setClip(Graphics::getClip());
+        font->renderString(&frame, x, y, text, fgcol, bkcol);
+        ShadowFrame::invalidate(Rect(x, y, font->getTextWidth(text), font->getHeight()));
+        ShadowFrame::present(display);
+#else
+        font->drawString(display, x, y, text, fgcol, bkcol);
+#endif
+        return;
+    }
+    if( DisplayList::m_textSize + len > DisplayList::TEXT_POOL_SIZE )
+    {
+        DisplayList::flush();
+    }
+    Op *op = DisplayList::append(display, DisplayList::OP_TEXT, Rect(x, y, font->getTextWidth(text), font->getHeight()));
+    op->fgcol = fgcol;
+    op->bkcol = bkcol;
+    op->object = font;
+    op->text = DisplayList::m_textSize;
+    memcpy(&DisplayList::m_textPool[DisplayList::m_textSize], text, len);
+    DisplayList::m_textSize += len;
+}
+
+// -----------------------------------------------------------------------------
+//  GlyphRun は記録中に書き換えられないこと(flush() まで参照する)
+// -----------------------------------------------------------------------------
+void DisplayList::drawRun(HX8357 *display, Font *font, int16_t x, int16_t y, int16_t width, const GlyphRun *run, uint16_t first, uint16_t last, uint16_t fgcol, uint16_t bkcol)
+{
+    Op *op = DisplayList::append(display, DisplayList::OP_RUN, Rect(x, y, width, font->getHeight()));
+    op->fgcol = fgcol;
+    op->bkcol = bkcol;
+    op->object = font;
+    op->run = run;
+    op->text = first;
+    op->last = last;
+}
+
+// -----------------------------------------------------------------------------
+void DisplayList::drawIcon(HX8357 *display, int16_t x, int16_t y, Icon *icon, uint16_t fgcol, uint16_t bkcol)
+{
+    Op *op = DisplayList::append(display, DisplayList::OP_ICON, Rect(x, y, icon->getWidth(), icon->getHeight()));
+    op->fgcol = fgcol;
+    op->bkcol = bkcol;
+    op->object = icon;
+}
+
+// -----------------------------------------------------------------------------
+void DisplayList::drawBitmap(HX8357 *display, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *image)
+{
+    Op *op = DisplayList::append(display, DisplayList::OP_IMAGE, Rect(x, y, w, h));
+    op->object = image;
+}
+
+// -----------------------------------------------------------------------------
+void DisplayList::drawImage(HX8357 *display, int16_t x, int16_t y, RunLengthImage *image)
+{
+    Op *op = DisplayList::append(display, DisplayList::OP_RLE_IMAGE, Rect(x, y, image->getWidth(), image->getHeight()));
+    op->object = image;
+}
+
+// -----------------------------------------------------------------------------
+//  後から描く命令のどれか１つに完全に覆われる命令を削除する
+// -----------------------------------------------------------------------------
+void DisplayList::removeOverdrawn()
+{
+    for( int i = 0 ; i < DisplayList::m_numOps ; i++ )
+    {
+        Op *op = &DisplayList::m_ops[i];
+        for( int j = i+1 ; !op->removed && (j < DisplayList::m_numOps) ; j++ )
+        {
+            Op *later = &DisplayList::m_ops[j];
+            if( !later->removed && !DisplayList::isClipped(later) && later->rc.include(op->rc) )
+            {
+                op->removed = true;
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  from < k < to の命令に rc と重なるものがあるか
+// -----------------------------------------------------------------------------
+bool DisplayList::isBlocked(int from, int to, Rect rc)
+{
+    for( int k = from+1 ; k < to ; k++ )
+    {
+        Op *op = &DisplayList::m_ops[k];
+        if( !op->removed && op->rc.intersect(rc) )
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+// -----------------------------------------------------------------------------
+//  同じ色で辺を共有する塗りつぶしを１つの矩形にまとめる
+//  間にある命令と重ならない方の位置へまとめる
+// -----------------------------------------------------------------------------
+void DisplayList::mergeFills()
+{
+    bool merged = true;
+    while( merged )
+    {
+        merged = false;
+        for( int i = 0 ; i < DisplayList::m_numOps ; i++ )
+        {
+            Op *a = &DisplayList::m_ops[i];
+            for( int j = i+1 ; !a->removed && (a->type == DisplayList::OP_FILL) && (j < DisplayList::m_numOps) ; j++ )
+            {
+                Op *b = &DisplayList::m_ops[j];
+                if( b->removed || (b->type != DisplayList::OP_FILL) || (b->fgcol != a->fgcol) )
+                {
+                    continue;
+                }
+                Rect u;
+                if( (a->rc.top == b->rc.top) && (a->rc.height == b->rc.height) &&
+                    ((a->rc.left+a->rc.width == b->rc.left) || (b->rc.left+b->rc.width == a->rc.left)) )
+                {
+                    u = Rect(min(a->rc.left, b->rc.left), a->rc.top, a->rc.width+b->rc.width, a->rc.height);
+                }
+                else if( (a->rc.left == b->rc.left) && (a->rc.width == b->rc.width) &&
+                    ((a->rc.top+a->rc.height == b->rc.top) || (b->rc.top+b->rc.height == a->rc.top)) )
+                {
+                    u = Rect(a->rc.left, min(a->rc.top, b->rc.top), a->rc.width, a->rc.height+b->rc.height);
+                }
+                else
+                {
+                    continue;
+                }
+
+                if( !DisplayList::isBlocked(i, j, b->rc) )
+                {
+                    a->rc = u;
+                    b->removed = true;
+                    merged = true;
+                }
+                else if( !DisplayList::isBlocked(i, j, a->rc) )
+                {
+                    b->rc = u;
+                    a->removed = true;
+                    merged = true;
+                }
+            }
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+void DisplayList::execute(Op *op)
+{
+    HX8357 *display = DisplayList::m_display;
+    display->setClipRect(op->clip.left, op->clip.top, op->clip.width, op->clip.height);
+    switch( op->type )
+    {
+        case DisplayList::OP_FILL:
+            display->fillRect(op->rc.left, op->rc.top, op->rc.width, op->rc.height, op->fgcol);
+            break;
+        case DisplayList::OP_TEXT:
+            ((Font *)op->object)->drawString(display, op->rc.left, op->rc.top, &DisplayList::m_textPool[op->text], op->fgcol, op->bkcol);
+            break;
+        case DisplayList::OP_RUN:
+            ((Font *)op->object)->drawRun(display, op->rc.left, op->rc.top, op->run, op->fgcol, op->bkcol, op->text, op->last);
+            break;
+        case DisplayList::OP_ICON:
+            ((Icon *)op->object)->draw(display, op->rc.left, op->rc.top, op->fgcol, op->bkcol);
+            break;
+        case DisplayList::OP_IMAGE:
+            display->drawBitmap(op->rc.left, op->rc.top, op->rc.width, op->rc.height, (const uint16_t *)op->object);
+            break;
+        case DisplayList::OP_RLE_IMAGE:
+            ((RunLengthImage *)op->object)->draw(display, op->rc.left, op->rc.top);
+            break;
+        case DisplayList::OP_STRIP:
+            DisplayList::renderStrip(op);
+            break;
+    }
+    op->removed = true;
+}
+
+// -----------------------------------------------------------------------------
+//  塗りつぶしを記録時のクリップ範囲で切り詰める
+//  (切り詰めた後はクリップ不要なので、まとめたり並べ替えたりしてよい)
+// -----------------------------------------------------------------------------
+void DisplayList::clipFill(Op *op)
+{
+    Rect rc = op->rc;
+    Rect clip = op->clip;
+    int16_t x0 = max(rc.left, clip.left);
+    int16_t y0 = max(rc.top, clip.top);
+    int16_t x1 = min((int16_t)(rc.left+rc.width), (int16_t)(clip.left+clip.width));
+    int16_t y1 = min((int16_t)(rc.top+rc.height), (int16_t)(clip.top+clip.height));
+    op->rc = Rect(x0, y0, max((int16_t)(x1 - x0), (int16_t)0), max((int16_t)(y1 - y0), (int16_t)0));
+    op->removed = op->rc.isEmpty();
+    op->clip = Rect(0, 0, Graphics::SCREEN_WIDTH, Graphics::SCREEN_HEIGHT);
+}
+
+// -----------------------------------------------------------------------------
+//  塗りつぶしの中に収まる後の命令をまとめ、塗りつぶしを OP_STRIP に変える
+//  間にある(まとめない)命令と重なる命令はまとめない(描画順が変わるため)
+//  まとめた命令は removed にして、OP_STRIP を実行するときに合成する
+// -----------------------------------------------------------------------------
+void DisplayList::buildStrips()
+{
+    HX8357 *display = DisplayList::m_display;
+    Rect screen(0, 0, display->getWidth(), display->getHeight());
+    for( int i = 0 ; i < DisplayList::m_numOps ; i++ )
+    {
+        Op *fill = &DisplayList::m_ops[i];
+        if( fill->removed || (fill->type != DisplayList::OP_FILL) || (fill->strip >= 0) || !screen.include(fill->rc) )
+        {
+            continue;
+        }
+        Op *tail = fill;
+        for( int j = i+1 ; j < DisplayList::m_numOps ; j++ )
+        {
+            Op *op = &DisplayList::m_ops[j];
+            if( op->removed || !fill->rc.include(op->rc) )
+            {
+                continue;
+            }
+            bool blocked = false;
+            for( int k = i+1 ; !blocked && (k < j) ; k++ )
+            {
+                Op *other = &DisplayList::m_ops[k];
+                blocked = !other->removed && (other->strip != i) && other->rc.intersect(op->rc);
+            }
+            if( !blocked )
+            {
+                op->strip = i;
+                tail->member = j;
+                tail = op;
+            }
+        }
+        if( tail == fill )
+        {
+            continue;   // 塗りつぶしだけなら flood の方が速い
+        }
+        fill->type = DisplayList::OP_STRIP;
+        for( int j = fill->member ; j >= 0 ; j = DisplayList::m_ops[j].member )
+        {
+            DisplayList::m_ops[j].removed = true;
+        }
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  命令を１つ Surface に合成する
+// -----------------------------------------------------------------------------
+void DisplayList::render(Surface *surface, Op *op)
+{
+    surface->setClip(op->clip);
+    switch( op->type )
+    {
+        case DisplayList::OP_FILL:
+        case DisplayList::OP_STRIP:
+            surface->fillRect(op->rc, op->fgcol);
+            break;
+        case DisplayList::OP_TEXT:
+            ((Font *)op->object)->renderString(surface, op->rc.left, op->rc.top, &DisplayList::m_textPool[op->text], op->fgcol, op->bkcol);
+            break;
+        case DisplayList::OP_RUN:
+            ((Font *)op->object)->renderRun(surface, op->rc.left, op->rc.top, op->run, op->fgcol, op->bkcol, op->text, op->last);
+            break;
+        case DisplayList::OP_ICON:
+            ((Icon *)op->object)->render(surface, op->rc.left, op->rc.top, op->fgcol, op->bkcol);
+            break;
+        case DisplayList::OP_IMAGE:
+            surface->drawImage(op->rc.left, op->rc.top, op->rc.width, op->rc.height, (const uint16_t *)op->object);
+            break;
+        case DisplayList::OP_RLE_IMAGE:
+            ((RunLengthImage *)op->object)->render(surface, op->rc.left, op->rc.top);
+            break;
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  OP_STRIP の範囲を上から帯ごとに合成して転送する
+// -----------------------------------------------------------------------------
+void DisplayList::renderStrip(Op *op)
+{
+    HX8357 *display = DisplayList::m_display;
+    int16_t rows = max(DisplayList::STRIP_PIXELS / op->rc.width, 1);
+    for( int16_t top = op->rc.top ; top < op->rc.top + op->rc.height ; top += rows )
+    {
+        int16_t height = min(rows, (int16_t)(op->rc.top + op->rc.height - top));
+        Surface surface(DisplayList::m_strip, Rect(op->rc.left, top, op->rc.width, height));
+        DisplayList::render(&surface, op);
+        for( int j = op->member ; j >= 0 ; j = DisplayList::m_ops[j].member )
+        {
+            Op *member = &DisplayList::m_ops[j];
+            if( surface.overlaps(member->rc.left, member->rc.top, member->rc.width, member->rc.height) )
+            {
+                DisplayList::render(&surface, member);
+            }
+        }
+        // 転送が終わってから次の帯を合成する(drawBitmap はその場で送出する)
+        display->drawBitmap(op->rc.left, top, op->rc.width, height, DisplayList::m_strip);
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  最適化して実行する
+//  次に実行する命令は、直前の命令とカラム範囲かページ範囲が一致するものを
+//  REORDER_RANGE 個先まで探す(飛び越す命令と重なるものは選ばない)
+// -----------------------------------------------------------------------------
+void DisplayList::flush()
+{
+    DisplayList::removeOverdrawn();
+    DisplayList::mergeFills();
+#ifdef SHADOW_FRAME
+    // 記録した順にシャドウフレームに描画し、変化した区間だけを転送する
+    Surface frame = ShadowFrame::getSurface();
+    for( int i = 0 ; i < DisplayList::m_numOps ; i++ )
+    {
+        Op *op = &DisplayList::m_ops[i];
+        if( !op->removed )
+        {
+            DisplayList::render(&frame, op);
+            ShadowFrame::invalidate(op->rc);
+        }
+    }
+    if( DisplayList::m_numOps > 0 )
+    {
+        ShadowFrame::present(DisplayList::m_display);
+    }
+#else
+    if( DisplayList::m_stripEnabled && (DisplayList::m_numOps > 0) )
+    {
+        DisplayList::buildStrips();
+    }
+
+    int16_t x1 = -1, x2 = -1, y1 = -1, y2 = -1;    // 直前のアドレスウィンドウ
+    int first = 0;
+    while( true )
+    {
+        while( (first < DisplayList::m_numOps) && DisplayList::m_ops[first].removed )
+        {
+            first++;
+        }
+        if( first >= DisplayList::m_numOps )
+        {
+            break;
+        }
+
+        Op *next = &DisplayList::m_ops[first];
+        int found = 0;
+        for( int j = first ; (j < DisplayList::m_numOps) && (found < DisplayList::REORDER_RANGE) ; j++ )
+        {
+            Op *op = &DisplayList::m_ops[j];
+            if( op->removed )
+            {
+                continue;
+            }
+            found++;
+            bool sameCols = (op->type != DisplayList::OP_TEXT) && (op->type != DisplayList::OP_RUN) && (op->rc.left == x1) && (op->rc.left+op->rc.width-1 == x2);
+            bool sameRows = (op->rc.top == y1) && (op->rc.top+op->rc.height-1 == y2);
+            if( (sameCols || sameRows) && !DisplayList::isBlocked(first-1, j, op->rc) )
+            {
+                next = op;
+                break;
+            }
+        }
+
+        DisplayList::execute(next);
+        if( (next->type == DisplayList::OP_TEXT) || (next->type == DisplayList::OP_RUN) )
+        {
+            x1 = x2 = -1;   // 文字ごとにカラム範囲が変わる
+        }
+        else
+        {
+            x1 = next->rc.left;
+            x2 = next->rc.left + next->rc.width - 1;
+        }
+        y1 = next->rc.top;
+        y2 = next->rc.top + next->rc.height - 1;
+    }
+#endif
+    if( DisplayList::m_display )
+    {
+        // 命令ごとに切り替えたクリップ範囲を描画中の部品のものに戻す
+        Rect clip = Graphics::getClip();
+        DisplayList::m_display->setClipRect(clip.left, clip.top, clip.width, clip.height);
+    }
+
+    DisplayList::m_numOps = 0;
+    DisplayList::m_textSize = 0;
 }
 
 
@@ -224,6 +1021,10 @@ void Graphics::drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *
 // -----------------------------------------------------------------------------
 //  コンストラクタ
 // -----------------------------------------------------------------------------
+#ifdef HX8357_STATS
+uint32_t UIWidget::m_drawCount = 0;
+#endif
+
 UIWidget::UIWidget(uint16_t id, UIWidget *parent, HX8357 *display, int16_t left, int16_t top, uint16_t width, uint16_t height)
     : m_id(id), m_parent(parent), m_position(Point(left, top)), 
     m_width(width), m_height(height), m_visible(true), m_captured(false)
@@ -402,15 +1203,105 @@ void UIWidget::refresh()
         return;
     }
 
+    DisplayList::begin();
     this->m_graphics->beginPaint();
     this->draw(this->m_graphics);
     this->m_graphics->endPaint();
+#ifdef HX8357_STATS
+    UIWidget::m_drawCount++;
+#endif
 
     this->m_children.forEach([](int n, void *value, void *param){
         UIWidget *child = (UIWidget *)value;
         child->refresh();
         return true;
     }, nullptr);
+    DisplayList::end();
+}
+
+// -----------------------------------------------------------------------------
+//  画面座標の矩形 rc と重なる部分だけを再描画する(子も含む)
+//  rc が子のどれかに完全に覆われていれば自身は描画しない(子は不透明とする)
+// -----------------------------------------------------------------------------
+void UIWidget::paint(Rect rc)
+{
+    if( !this->isVisible() )
+    {
+        return;
+    }
+    Rect own = this->clientToScreen(this->getClientRect());
+    if( !own.intersect(rc) )
+    {
+        return;
+    }
+
+    struct CoverTest
+    {
+        Rect rc;
+        bool covered;
+    };
+    CoverTest test = { rc, false };
+    this->m_children.forEach([](int n, void *value, void *param){
+        UIWidget *child = (UIWidget *)value;
+        CoverTest *test = (CoverTest *)param;
+        test->covered = child->isVisible() && child->clientToScreen(child->getClientRect()).include(test->rc);
+        return !test->covered;
+    }, &test);
+
+    DisplayList::begin();
+    if( !test.covered )
+    {
+        rc.offset(-own.left, -own.top);
+        this->m_graphics->beginPaint();
+        this->m_graphics->pushClip(rc);
+        this->draw(this->m_graphics);
+        this->m_graphics->popClip();
+        this->m_graphics->endPaint();
+#ifdef HX8357_STATS
+        UIWidget::m_drawCount++;
+#endif
+    }
+    this->m_children.forEach([](int n, void *value, void *param){
+        UIWidget *child = (UIWidget *)value;
+        child->paint(*(Rect *)param);
+        return true;
+    }, &test.rc);
+    DisplayList::end();
+}
+
+// -----------------------------------------------------------------------------
+//  クライアント領域全体の再描画を予約する
+// -----------------------------------------------------------------------------
+void UIWidget::invalidate()
+{
+    this->invalidate(this->getClientRect());
+}
+
+// -----------------------------------------------------------------------------
+//  クライアント座標の矩形 rc の再描画を予約する
+//  (最上位の部品(Desktop)が範囲を覚えておき、後でまとめて描画する)
+// -----------------------------------------------------------------------------
+void UIWidget::invalidate(Rect rc)
+{
+    if( !this->isVisible() )
+    {
+        return;
+    }
+    UIWidget *root = this;
+    while( root->m_parent )
+    {
+        root = root->m_parent;
+    }
+    root->addDirtyRect(this->clientToScreen(rc));
+}
+
+// -----------------------------------------------------------------------------
+//  再描画が必要な範囲を受け取る
+//  (Desktop 以外が最上位の場合は、すぐに描画する)
+// -----------------------------------------------------------------------------
+void UIWidget::addDirtyRect(Rect rc)
+{
+    this->paint(rc);
 }
 
 //------------------------------------------------------------------------------
@@ -422,54 +1313,120 @@ void UIWidget::draw(Graphics *g)
 }
 
 
+// =============================================================================
+//  PresentScheduler
+// =============================================================================
+UIWidget *PresentScheduler::m_pending[PresentScheduler::MAX_PENDING];
+int       PresentScheduler::m_numPending = 0;
+uint32_t  PresentScheduler::m_requestTime = 0;
+
+// -----------------------------------------------------------------------------
+void PresentScheduler::request(UIWidget *widget)
+{
+    for( int i = 0 ; i < PresentScheduler::m_numPending ; i++ )
+    {
+        if( PresentScheduler::m_pending[i] == widget )
+        {
+            return;
+        }
+    }
+    if( PresentScheduler::m_numPending >= PresentScheduler::MAX_PENDING )
+    {
+        PresentScheduler::flush();
+    }
+    if( PresentScheduler::m_numPending == 0 )
+    {
+        PresentScheduler::m_requestTime = micros();
+    }
+    PresentScheduler::m_pending[PresentScheduler::m_numPending++] = widget;
+}
+
+// -----------------------------------------------------------------------------
+//  TE 直後なら予約された描画を行う(loop() から毎回呼ぶ)
+// -----------------------------------------------------------------------------
+void PresentScheduler::execute()
+{
+    if( PresentScheduler::m_numPending == 0 )
+    {
+        return;
+    }
+    if( HX8357::isTearWindow() || (micros() - PresentScheduler::m_requestTime >= PresentScheduler::MAX_DELAY) )
+    {
+        PresentScheduler::flush();
+    }
+}
+
+// -----------------------------------------------------------------------------
+void PresentScheduler::flush()
+{
+    for( int i = 0 ; i < PresentScheduler::m_numPending ; i++ )
+    {
+        UIWidget *widget = PresentScheduler::m_pending[i];
+        if( widget->isVisible() )
+        {
+            widget->present();
+        }
+    }
+    PresentScheduler::m_numPending = 0;
+}
+
+
 // =============================================================================
 //  Label
 // =============================================================================
 Label::Label(uint16_t id, UIWidget *parent, HX8357 *display, int16_t left, int16_t top, uint16_t width, uint16_t height, int size)
     : UIWidget(id, parent, display, left, top, width, height),
-    m_padding(0), m_alignment(0)
+    m_drawnValid(false), m_padding(0), m_alignment(0)
 {
     this->m_text = new char[size];
     this->m_text[0] = '\0';
+    this->m_graphics->shapeText(this->m_text, &this->m_run);
 }
 
 // -----------------------------------------------------------------------------
 Label::Label(uint16_t id, UIWidget *parent, HX8357 *display, int16_t left, int16_t top, uint16_t width, uint16_t height, const char *text)
     : UIWidget(id, parent, display, left, top, width, height),
-    m_padding(0), m_alignment(0)
+    m_drawnValid(false), m_padding(0), m_alignment(0)
 {
     this->m_text = new char[strlen(text)+1];
     strcpy(this->m_text, text);
+    this->m_graphics->shapeText(this->m_text, &this->m_run);
 }
 
 // -----------------------------------------------------------------------------
 void Label::setPadding(int16_t value)
 {
     this->m_padding = value;
+    this->m_drawnValid = false;
 }
 
 // -----------------------------------------------------------------------------
 void Label::setTextAlign(uint8_t align)
 {
     this->m_alignment = align;
+    this->m_drawnValid = false;
 }
 
 // -----------------------------------------------------------------------------
 void Label::setTextColor(uint16_t color)
 {
     this->m_graphics->setFontColor(color);
+    this->m_drawnValid = false;
 }
 
 // -----------------------------------------------------------------------------
 void Label::setBackColor(uint16_t color)
 {
     this->m_graphics->setFillColor(color);
+    this->m_drawnValid = false;
 }
 
 // -----------------------------------------------------------------------------
 void Label::setFont(int index)
 {
     this->m_graphics->setFont(index);
+    this->m_graphics->shapeText(this->m_text, &this->m_run);
+    this->m_drawnValid = false;
 }
 
 // -----------------------------------------------------------------------------
@@ -483,6 +1440,41 @@ void Label::setText(const char *text)
     {
         this->m_text[0] = '\0';
     }
+    // 描画のたびに分解しなくて済むよう、ここで一度だけ分解する
+    this->m_graphics->shapeText(this->m_text, &this->m_run);
+    // 変わった部分だけを後で描画する(refresh() すれば全体を描画し直す)
+    if( this->isVisible() )
+    {
+        PresentScheduler::request(this);
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  分解済みの文字列(ラベルのフォントで分解したもの)があればそれを使う
+// -----------------------------------------------------------------------------
+void Label::setText(const char *text, const GlyphRun *run)
+{
+    if( !text || !run )
+    {
+        this->setText(text);
+        return;
+    }
+    strcpy(this->m_text, text);
+    this->m_run.assign(run, this->m_graphics->getFont());
+    if( this->isVisible() )
+    {
+        PresentScheduler::request(this);
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  描画した文字列と位置を覚えておく
+// -----------------------------------------------------------------------------
+void Label::setDrawn(Point pt)
+{
+    this->m_drawn.assign(&this->m_run, this->m_run.getFont());
+    this->m_drawnPos = pt;
+    this->m_drawnValid = true;
 }
 
 // -----------------------------------------------------------------------------
@@ -493,7 +1485,88 @@ void Label::draw(Graphics *g)
     g->setFillColor(COLOR_BLACK);
     g->fillRect(rc);
     rc.inflate(-this->m_padding, -this->m_padding);
-    g->drawText(rc, this->m_text, this->m_alignment);
+    g->drawText(rc, &this->m_run, this->m_alignment);
+    if( Graphics::getClip().include(this->clientToScreen(this->getClientRect())) )
+    {
+        this->setDrawn(g->alignText(rc, this->m_run.getFont(), this->m_run.getWidth(), this->m_alignment));
+    }
+    else
+    {
+        this->m_drawnValid = false;     // 一部だけ描画した(次の present() で全体を描画する)
+    }
+}
+
+// -----------------------------------------------------------------------------
+//  setText() 後の描画
+//  前回描画した文字列と比べ、位置も含めて一致する先頭・末尾のグリフは描画せず、
+//  その間のグリフと、文字列が短くなった分の背景だけを描画する
+// -----------------------------------------------------------------------------
+void Label::present()
+{
+    Graphics *g = this->m_graphics;
+    Font *font = this->m_run.getFont();
+    Rect rc = this->getClientRect();
+    rc.inflate(-this->m_padding, -this->m_padding);
+    Point pt = g->alignText(rc, font, this->m_run.getWidth(), this->m_alignment);
+    if( !this->m_drawnValid || (this->m_drawn.getFont() != font) || (this->m_drawnPos.y != pt.y) )
+    {
+        g->beginPaint();
+        this->draw(g);
+        g->endPaint();
+        return;
+    }
+
+    const GlyphRun *prev = &this->m_drawn;
+    const GlyphRun *next = &this->m_run;
+    uint16_t prevCount = prev->getCount();
+    uint16_t nextCount = next->getCount();
+
+    // 先頭から一致するグリフ
+    uint16_t head = 0;
+    int16_t prevLeft = this->m_drawnPos.x;
+    int16_t nextLeft = pt.x;
+    while( (head < prevCount) && (head < nextCount) && (prevLeft == nextLeft) && prev->isSameGlyph(head, next, head) )
+    {
+        prevLeft += prev->getGlyphWidth(head);
+        nextLeft += next->getGlyphWidth(head);
+        head++;
+    }
+    // 末尾から一致するグリフ
+    uint16_t tail = 0;
+    int16_t prevRight = this->m_drawnPos.x + prev->getWidth();
+    int16_t nextRight = pt.x + next->getWidth();
+    while( (head + tail < prevCount) && (head + tail < nextCount) && (prevRight == nextRight)
+        && prev->isSameGlyph(prevCount-1-tail, next, nextCount-1-tail) )
+    {
+        prevRight -= prev->getGlyphWidth(prevCount-1-tail);
+        nextRight -= next->getGlyphWidth(nextCount-1-tail);
+        tail++;
+    }
+    if( (head + tail == prevCount) && (head + tail == nextCount) )
+    {
+        return;     // 変化なし
+    }
+
+    g->beginPaint();
+    g->setFillColor(COLOR_BLACK);
+    // 背景はクライアント領域の中だけを塗る
+    int16_t width = this->getClientRect().width;
+    int16_t height = font->getHeight();
+    int16_t x0 = max(min(prevLeft, nextLeft), (int16_t)0);
+    int16_t x1 = min(nextLeft, width);
+    if( x0 < x1 )
+    {
+        g->fillRect(x0, pt.y, x1 - x0, height);
+    }
+    g->drawRun(nextLeft, pt.y, next, head, nextCount - tail);
+    x0 = max(nextRight, (int16_t)0);
+    x1 = min(max(prevRight, nextRight), width);
+    if( x0 < x1 )
+    {
+        g->fillRect(x0, pt.y, x1 - x0, height);
+    }
+    g->endPaint();
+    this->setDrawn(pt);
 }
 
 
@@ -511,14 +1584,14 @@ Button::Button(uint16_t id, UIWidget *parent, HX8357 *display, int16_t left, int
 void Button::onTouched(int16_t x, int16_t y)
 {
     UIWidget::onTouched(x, y);
-    this->refresh();
+    this->invalidate();
 }
 
 // -----------------------------------------------------------------------------
 void Button::onReleased()
 {
     UIWidget::onReleased();
-    this->refresh();
+    this->invalidate();
     if( this->m_callback )
     {
         this->m_callback(this, this->m_param);
@@ -579,7 +1652,7 @@ void ListBox::setSelection(int index)
         {
             this->m_pageIndex = page;
             this->m_selectedIndex = index;
-            this->refresh();
+            this->invalidate();
             return;
         }
         if( this->m_drawItemProc )
@@ -727,7 +1800,7 @@ void ListBox::prevPage()
     if( this->canMovePrevPage() )
     {
         --(this->m_pageIndex);
-        this->refresh();
+        this->invalidate();
     }
 }
 
@@ -737,17 +1810,7 @@ void ListBox::nextPage()
     if( this->canMoveNextPage() )
     {
         ++(this->m_pageIndex);
-        Serial.print("next page index : ");
-        Serial.println(this->m_pageIndex, DEC);
-        this->refresh();
-    }
-    else
-    {
-        Serial.println("cannot move next");
-        Serial.println(this->m_itemCount, DEC);
-        Serial.println(this->m_pageIndex, DEC);
-        Serial.println(this->m_pageSize, DEC);
-        Serial.println(this->getLastPageIndex(), DEC);
+        this->invalidate();
     }
 }
 
@@ -801,7 +1864,7 @@ SevenSegLabel::SevenSegLabel(uint16_t id, UIWidget *parent, HX8357 *display, int
     {
         for( uint16_t i = 0 ; i < 11 ; i++ )
         {
-            SevenSegLabel::m_icon[i] = new Icon(SSEG_DIGITS+i*(2+SevenSegLabel::DIGIT_WIDTH*SevenSegLabel::DIGIT_HEIGHT));
+            SevenSegLabel::m_icon[i] = new Icon(SSEG_DIGITS+SSEG_DIGITS_OFFSET[i]);
         }
     }
 }
@@ -837,12 +1900,18 @@ void SevenSegLabel::setValue(uint16_t value)
     }
     if( needDraw && this->isVisible() )
     {
-        this->m_graphics->beginPaint();
-        this->draw(this->m_graphics);
-        this->m_graphics->endPaint();
+        PresentScheduler::request(this);
     }
 }
 
+// -----------------------------------------------------------------------------
+void SevenSegLabel::present()
+{
+    this->m_graphics->beginPaint();
+    this->draw(this->m_graphics);
+    this->m_graphics->endPaint();
+}
+
 // -----------------------------------------------------------------------------
 void SevenSegLabel::draw(Graphics *g)
 {
@@ -879,6 +1948,18 @@ void SevenSegLabel::refresh()
     UIWidget::refresh();
 }
 
+// -----------------------------------------------------------------------------
+//  背景ごと描き直されるので、範囲内の桁はすべて描画する
+// -----------------------------------------------------------------------------
+void SevenSegLabel::paint(Rect rc)
+{
+    for( int16_t i = 0 ; i < this->m_length ; i++ )
+    {
+        this->m_dirty[i] = true;
+    }
+    UIWidget::paint(rc);
+}
+
 
 // =============================================================================
 //  PaintBox
@@ -909,7 +1990,8 @@ const float SpectrumView::SCALE = 100;
 
 // -----------------------------------------------------------------------------
 SpectrumView::SpectrumView(uint16_t id, UIWidget *parent, HX8357 *display, int16_t left, int16_t top)
-    : UIWidget(id, parent, display, left, top, 288, 50)
+    : UIWidget(id, parent, display, left, top, 288, 50),
+    m_interval(1000 / SpectrumView::DEFAULT_FRAME_RATE), m_lastPresent(0)
 {
     for( int i = 0 ; i < SpectrumView::NUM_BANDS ; i++ )
     {
@@ -960,12 +2042,7 @@ void SpectrumView::update(AudioAnalyzeFFT1024 *fft)
                 }
             }
         }
-        if( this->isVisible() )
-        {
-            this->m_graphics->beginPaint();
-            this->internalDraw(this->m_graphics);
-            this->m_graphics->endPaint();
-        }
+        this->requestPresent();
     }
 }
 
@@ -976,14 +2053,29 @@ void SpectrumView::clear()
     {
         this->m_spectrum[i] = 0;
     }
-    if( this->isVisible() )
+    this->requestPresent();
+}
+
+// -----------------------------------------------------------------------------
+//  前回の描画から m_interval 以上経っていれば描画を予約する
+// -----------------------------------------------------------------------------
+void SpectrumView::requestPresent()
+{
+    if( this->isVisible() && (millis() - this->m_lastPresent >= this->m_interval) )
     {
-        this->m_graphics->beginPaint();
-        this->internalDraw(this->m_graphics);
-        this->m_graphics->endPaint();
+        PresentScheduler::request(this);
     }
 }
 
+// -----------------------------------------------------------------------------
+void SpectrumView::present()
+{
+    this->m_lastPresent = millis();
+    this->m_graphics->beginPaint();
+    this->internalDraw(this->m_graphics);
+    this->m_graphics->endPaint();
+}
+
 // -----------------------------------------------------------------------------
 void SpectrumView::internalDraw(Graphics *g)
 {
@@ -1091,6 +2183,93 @@ Desktop::Desktop(HX8357 *display)
     this->m_label->setTextAlign(Graphics::ALIGN_CENTER);
     this->m_label->setFont(Graphics::LARGE_FONT);
     this->m_label->hide();
+    this->m_logo = new RunLengthImage(LOGO);
+    this->m_numDirty = 0;
+}
+
+// -----------------------------------------------------------------------------
+//  再描画が必要な範囲を加える
+//  重なる(接する)範囲は１つの矩形にまとめる
+// -----------------------------------------------------------------------------
+void Desktop::addDirtyRect(Rect rc)
+{
+    int16_t x0 = max(rc.left, (int16_t)0);
+    int16_t y0 = max(rc.top, (int16_t)0);
+    int16_t x1 = min((int16_t)(rc.left+rc.width), (int16_t)Graphics::SCREEN_WIDTH);
+    int16_t y1 = min((int16_t)(rc.top+rc.height), (int16_t)Graphics::SCREEN_HEIGHT);
+    if( (x0 >= x1) || (y0 >= y1) )
+    {
+        return;
+    }
+
+    // 重なる範囲を取り込む(取り込むと広がるので、重なるものがなくなるまで繰り返す)
+    bool merged = true;
+    while( merged )
+    {
+        merged = false;
+        for( int i = 0 ; i < this->m_numDirty ; i++ )
+        {
+            Rect *dirty = &this->m_dirty[i];
+            if( (x0 <= dirty->left+dirty->width) && (dirty->left <= x1) &&
+                (y0 <= dirty->top+dirty->height) && (dirty->top <= y1) )
+            {
+                x0 = min(x0, dirty->left);
+                y0 = min(y0, dirty->top);
+                x1 = max(x1, (int16_t)(dirty->left+dirty->width));
+                y1 = max(y1, (int16_t)(dirty->top+dirty->height));
+                *dirty = this->m_dirty[--this->m_numDirty];
+                merged = true;
+                break;
+            }
+        }
+    }
+    if( this->m_numDirty == Desktop::MAX_DIRTY_RECTS )
+    {
+        // いっぱいなので、面積の増え方が最も小さい範囲を取り込む
+        int best = 0;
+        int32_t bestGrowth = INT32_MAX;
+        for( int i = 0 ; i < this->m_numDirty ; i++ )
+        {
+            Rect *dirty = &this->m_dirty[i];
+            int32_t w = max(x1, (int16_t)(dirty->left+dirty->width)) - min(x0, dirty->left);
+            int32_t h = max(y1, (int16_t)(dirty->top+dirty->height)) - min(y0, dirty->top);
+            int32_t growth = w*h - (int32_t)(x1 - x0)*(y1 - y0) - (int32_t)dirty->width*dirty->height;
+            if( growth < bestGrowth )
+            {
+                bestGrowth = growth;
+                best = i;
+            }
+        }
+        Rect *dirty = &this->m_dirty[best];
+        x0 = min(x0, dirty->left);
+        y0 = min(y0, dirty->top);
+        x1 = max(x1, (int16_t)(dirty->left+dirty->width));
+        y1 = max(y1, (int16_t)(dirty->top+dirty->height));
+        *dirty = this->m_dirty[--this->m_numDirty];
+    }
+    this->m_dirty[this->m_numDirty++] = Rect(x0, y0, x1 - x0, y1 - y0);
+}
+
+// -----------------------------------------------------------------------------
+//  予約された範囲を再描画する(Application::loop() から１回ずつ呼ぶ)
+// -----------------------------------------------------------------------------
+void Desktop::update()
+{
+    if( this->m_numDirty == 0 )
+    {
+        return;
+    }
+    Rect dirty[Desktop::MAX_DIRTY_RECTS];
+    int count = this->m_numDirty;
+    memcpy(dirty, this->m_dirty, count * sizeof(Rect));
+    this->m_numDirty = 0;
+
+    DisplayList::begin();
+    for( int i = 0 ; i < count ; i++ )
+    {
+        this->paint(dirty[i]);
+    }
+    DisplayList::end();
 }
 
 // -----------------------------------------------------------------------------
@@ -1120,8 +2299,75 @@ void Desktop::draw(Graphics *g)
 {
     g->setFillColor(COLOR_BLACK);
     g->fillRect(this->getClientRect());
-    g->drawBitmap(90, 60, 300, 150, const_cast<uint16_t *>(LOGO+2));
+    g->drawImage(90, 60, this->m_logo);
+}
+
+#ifdef HX8357_STATS
+// -----------------------------------------------------------------------------
+//  アイコンとロゴの描画方法ごとのバス転送量と時間を計測する
+//  (アイコンは Icon::draw() がキャッシュにないとき展開しながら直接送る・
+//   キャッシュにあるとき合成済みの画像を送る・毎回全体を合成する、
+//   ロゴは展開しながら直接送る・数行ずつ展開してから送る)
+// -----------------------------------------------------------------------------
+void Desktop::measureImages(HX8357 *display)
+{
+    enum{COUNT = 20};
+    Icon icon(ICON_PLAY_48);
+    int16_t x = (Graphics::SCREEN_WIDTH - icon.getWidth()) / 2;
+    int16_t y = (Graphics::SCREEN_HEIGHT - icon.getHeight()) / 2;
+    for( int method = 0 ; method < 3 ; method++ )
+    {
+        static const char *labels[] = {"icon stream", "icon cache", "icon blend"};
+        if( method == 0 )
+        {
+            IconCache().clear();
+        }
+        else if( method == 1 )
+        {
+            IconCache().get(icon.getData(), 0, icon.getData(), icon.getWidth()*icon.getHeight(), COLOR_WHITE, COLOR_BLACK, BlendCache::RUN_LENGTH);
+        }
+        HX8357::resetStats();
+        uint32_t t = micros();
+        for( int i = 0 ; i < COUNT ; i++ )
+        {
+            switch( method )
+            {
+                case 0:
+                case 1:
+                    icon.draw(display, x, y, COLOR_WHITE, COLOR_BLACK);
+                    break;
+                case 2:
+                    icon.drawBlend(display, x, y, COLOR_WHITE, COLOR_BLACK);
+                    break;
+            }
+        }
+        HX8357::wait();
+        t = micros() - t;
+        HX8357::printStats(labels[method]);
+        Serial.printf("[%s] %lu draws %luus\n", labels[method], (unsigned long)COUNT, (unsigned long)t);
+    }
+
+    // 最下行がクリップ範囲からはみ出すようにすると、ロゴは数行ずつ展開する方法で描画される
+    for( int method = 0 ; method < 2 ; method++ )
+    {
+        static const char *labels[] = {"logo stream", "logo staging"};
+        if( method == 1 )
+        {
+            display->setClipRect(0, 0, Graphics::SCREEN_WIDTH, 60 + this->m_logo->getHeight() - 1);
+        }
+        HX8357::resetStats();
+        uint32_t t = micros();
+        this->m_logo->draw(display, 90, 60);
+        HX8357::wait();
+        t = micros() - t;
+        HX8357::printStats(labels[method]);
+        Serial.printf("[%s] %luus\n", labels[method], (unsigned long)t);
+    }
+    display->setClipRect();
+    // 計測で描いたものを消しておく(シャドウフレームは黒で塗りつぶした状態から始まる)
+    display->fillScreen(COLOR_BLACK);
 }
+#endif
 
 // ================================================================================
 //  PlaybackView
@@ -1200,24 +2446,34 @@ void PlaybackView::handlePlayerEvent(MusicPlayer *player, uint16_t eventId, void
         case MusicPlayer::EVT_ALBUM_CHANGED:
             Serial.println("album changed");
             album = player->getPlayList()->getAlbum();
-            self->m_albumTitleLabel->setText(album->getTitle());
-            self->m_albumTitleLabel->refresh();
-            self->m_artistNameLabel->setText(album->getArtist()->getName());
-            self->m_artistNameLabel->refresh();
+            // ラベルは setText() で変わった部分だけが描画される
+            self->m_albumTitleLabel->setText(album->getTitle(), album->getTitleRun(Graphics::SMALL_FONT));
+            self->m_artistNameLabel->setText(album->getArtist()->getName(), album->getArtist()->getNameRun(Graphics::SMALL_FONT));
             sprintf(buffer, "%04d年 / %02d:%02d", (int)(album->getYear()), (int)(album->getTotalTime()/60), (int)(album->getTotalTime()%60));
             self->m_albumInfoLabel->setText(buffer);
-            self->m_albumInfoLabel->refresh();
-            self->m_coverImagePaintBox->refresh();
+            self->m_coverImagePaintBox->invalidate();
             // not break        
         case MusicPlayer::EVT_STATUS_CHANGED:
             Serial.println("status changed");
-            self->m_statusPaintBox->refresh();
+            self->m_statusPaintBox->invalidate();
             // not break
         case MusicPlayer::EVT_TRACK_CHANGED:
             Serial.println("track changed");
             self->m_trackLabel->setValue(player->getCurrentTrackNumber());
-            self->m_songTitleLabel->setText(player->getCurrentSongTitle());
-            self->m_songTitleLabel->refresh();
+#ifdef HX8357_STATS
+            {
+                // 曲名の分解(setText)と描画(refresh)にかかる時間
+                uint32_t t0 = micros();
+                self->m_songTitleLabel->setText(player->getCurrentSongTitle(), player->getCurrentSongTitleRun(Graphics::LARGE_FONT));
+                uint32_t t1 = micros();
+                self->m_songTitleLabel->refresh();
+                HX8357::wait();
+                uint32_t t2 = micros();
+                Serial.printf("song title: shape %luus refresh %luus\n", (unsigned long)(t1 - t0), (unsigned long)(t2 - t1));
+            }
+#else
+            self->m_songTitleLabel->setText(player->getCurrentSongTitle(), player->getCurrentSongTitleRun(Graphics::LARGE_FONT));
+#endif
             if( player->isPlaying() )
             {
                 elapsed = player->getCurrentSongLength();
@@ -1235,8 +2491,12 @@ void PlaybackView::handlePlayerEvent(MusicPlayer *player, uint16_t eventId, void
                 self->m_trackLengthLabel->setText("");
                 self->m_codecInfoLabel->setText("");
             }
-            self->m_trackLengthLabel->refresh();
-            self->m_codecInfoLabel->refresh();
+#ifdef HX8357_STATS
+            // 曲が変わったときのラベルの差分描画のバス転送量
+            HX8357::resetStats();
+            PresentScheduler::flush();
+            HX8357::printStats("track change");
+#endif
             // not break
         case MusicPlayer::EVT_TIME_CHANGED:
             elapsed = player->getElapsedTime();
@@ -1432,8 +2692,19 @@ void SelectSongView::onDrawListItem(DRAWITEMSTRUCT *dis)
     char str[128];
     PlayList *playlist = this->m_player->getPlayList();
     dis->graphics->setFont(Graphics::LARGE_FONT);
-    sprintf(str, "%02d. %s", 1+dis->index, playlist->getTitle(dis->index));
-    dis->graphics->drawText(dis->rect.left+4, dis->rect.top+10, str);
+    const GlyphRun *run = playlist->getTitleRun(dis->index, Graphics::LARGE_FONT);
+    if( run )
+    {
+        // 分解済みのタイトルがあれば、曲番号だけを文字列として描画する
+        sprintf(str, "%02d. ", 1+dis->index);
+        dis->graphics->drawText(dis->rect.left+4, dis->rect.top+10, str);
+        dis->graphics->drawText(dis->rect.left+4+dis->graphics->getTextWidth(str), dis->rect.top+10, run);
+    }
+    else
+    {
+        sprintf(str, "%02d. %s", 1+dis->index, playlist->getTitle(dis->index));
+        dis->graphics->drawText(dis->rect.left+4, dis->rect.top+10, str);
+    }
     dis->graphics->setFont(Graphics::SMALL_FONT);
     uint16_t duration = playlist->getDuration(dis->index);
     sprintf(str, "%02d:%02d (%s %dHz %dkbps)", 
@@ -1483,7 +2754,7 @@ void SelectSongView::updateToolBar()
     {
         downButton->hide();
     }
-    this->m_toolbar->refresh();
+    this->m_toolbar->invalidate();
 }
 
 // -----------------------------------------------------------------------------
@@ -1591,7 +2862,7 @@ void SelectAlbumView::updateToolBar()
     {
         downButton->hide();
     }
-    this->m_toolbar->refresh();
+    this->m_toolbar->invalidate();
 }
 
 // -----------------------------------------------------------------------------
@@ -1649,7 +2920,15 @@ void SelectAlbumView::onDrawListItem(DRAWITEMSTRUCT *dis)
     char str[128];
     Album *album = this->m_artist->getAlbum(dis->index);
     dis->graphics->setFont(Graphics::LARGE_FONT);
-    dis->graphics->drawText(dis->rect.left+10, dis->rect.top+10, album->getTitle());
+    const GlyphRun *run = album->getTitleRun(Graphics::LARGE_FONT);
+    if( run )
+    {
+        dis->graphics->drawText(dis->rect.left+10, dis->rect.top+10, run);
+    }
+    else
+    {
+        dis->graphics->drawText(dis->rect.left+10, dis->rect.top+10, album->getTitle());
+    }
     dis->graphics->setFont(Graphics::SMALL_FONT);
     int totalTime = (int)album->getTotalTime();
     int numTracks = (int)album->getNumTracks();
@@ -1757,7 +3036,7 @@ void SelectArtistView::updateToolBar()
     {
         downButton->hide();
     }
-    this->m_toolbar->refresh();
+    this->m_toolbar->invalidate();
 }
 
 // -----------------------------------------------------------------------------
@@ -1815,7 +3094,15 @@ void SelectArtistView::onDrawListItem(DRAWITEMSTRUCT *dis)
     char str[128];
     Artist *artist = this->m_artistList->getArtist(dis->index);
     dis->graphics->setFont(Graphics::LARGE_FONT);
-    dis->graphics->drawText(dis->rect.left+10, dis->rect.top+10, artist->getName());
+    const GlyphRun *run = artist->getNameRun(Graphics::LARGE_FONT);
+    if( run )
+    {
+        dis->graphics->drawText(dis->rect.left+10, dis->rect.top+10, run);
+    }
+    else
+    {
+        dis->graphics->drawText(dis->rect.left+10, dis->rect.top+10, artist->getName());
+    }
     dis->graphics->setFont(Graphics::SMALL_FONT);
     sprintf(str, "%d album(s)", (int)(artist->getNumAlbums()));
     Point pt = dis->rect.bottomRight().offset(-4, -4);
@@ -48,6 +48,130 @@ class TouchManager
         void execute(UIWidget *listener);
 };
 
+// 画面全体の影(シャドウフレーム)を PSRAM に持つ場合は有効にする
+// #define SHADOW_FRAME
+
+// -----------------------------------------------------------------------------
+//  シャドウフレーム
+//  ディスプレイリストの命令を PSRAM 上の画面の写しに描画し、前回転送した内容と
+//  比べて変化した横方向の区間だけを転送する
+//  (変化のない再描画はバスに何も出さない)
+// -----------------------------------------------------------------------------
+#ifdef SHADOW_FRAME
+class ShadowFrame
+{
+    private:
+        enum{
+            WIDTH = 480,
+            HEIGHT = 320,
+            MERGE_GAP = 6       // これ以下の一致区間はアドレスウィンドウを設定し直さずに送る
+        };
+        static uint16_t m_frame[WIDTH*HEIGHT];      // 描画先
+        static uint16_t m_presented[WIDTH*HEIGHT];  // パネルに転送済みの内容
+        static Rect     m_dirty;                    // 前回の転送以降に描画した範囲
+#ifdef HX8357_STATS
+        static uint32_t m_frames;
+        static uint32_t m_spans;
+        static uint32_t m_pixels;
+        static uint32_t m_busBytes;
+#endif
+
+    public:
+        static void begin(uint16_t color);
+        static Surface getSurface(){ return Surface(m_frame, Rect(0, 0, WIDTH, HEIGHT)); }
+        static void invalidate(Rect rc);
+        static void present(HX8357 *display);
+#ifdef HX8357_STATS
+        static void resetStats();
+        static void printStats(const char *label);
+#endif
+};
+#endif
+
+// -----------------------------------------------------------------------------
+//  ディスプレイリスト
+//  UIWidget::refresh() の間の描画命令を記録しておき、まとめて実行する。
+//  実行前に次の最適化を行う(描画命令はすべて矩形を不透明に塗るので、
+//  重なりのない命令どうしは順序を入れ替えてよい)
+//    ・後の命令に完全に覆われる命令を削除する
+//    ・同じ色で隣接する塗りつぶしを１つにまとめる
+//    ・アドレスウィンドウ(CASET/PASET)が直前と共通する命令を先に実行する
+//    ・塗りつぶしと、その中に収まる後の命令を RAM 上の帯(ストリップ)で合成し、
+//      一度だけ転送する(重ね描きによる二度書きとちらつきをなくす)
+// -----------------------------------------------------------------------------
+class DisplayList
+{
+    private:
+        enum{
+            MAX_OPS = 192,
+            TEXT_POOL_SIZE = 2048,
+            REORDER_RANGE = 16,     // 並べ替えで先読みする命令数
+            STRIP_PIXELS = 480*20   // ストリップのピクセル数
+        };
+        enum{
+            OP_FILL,
+            OP_TEXT,
+            OP_RUN,
+            OP_ICON,
+            OP_IMAGE,
+            OP_RLE_IMAGE,           // ランレングス圧縮した画像(RunLengthImage)
+            OP_STRIP                // 塗りつぶしと、そこに収まる命令をストリップで合成する
+        };
+        struct Op
+        {
+            uint8_t     type;
+            bool        removed;
+            Rect        rc;         // 描画範囲(画面座標)
+            uint16_t    fgcol;      // 塗りつぶし色・文字色・アイコン色
+            uint16_t    bkcol;
+            const void *object;     // Font, Icon, RunLengthImage または画像データ
+            const GlyphRun *run;    // OP_RUN の文字列
+            uint16_t    text;       // m_textPool 内の位置(OP_RUN では描画する最初のグリフ)
+            uint16_t    last;       // OP_RUN で描画する最後のグリフの次
+            int16_t     strip;      // 合成先の OP_STRIP の位置(なければ -1)
+            int16_t     member;     // 同じストリップで次に合成する命令の位置(なければ -1)
+            Rect        clip;       // 記録したときのクリップ範囲(画面座標)
+        };
+        static HX8357 *m_display;
+        static Op      m_ops[MAX_OPS];
+        static int     m_numOps;
+        static char    m_textPool[TEXT_POOL_SIZE];
+        static int     m_textSize;
+        static int     m_depth;
+        static bool    m_enabled;
+        static bool    m_stripEnabled;
+        static uint16_t m_strip[STRIP_PIXELS];
+
+        static Op *append(HX8357 *display, uint8_t type, Rect rc);
+        static void removeOverdrawn();
+        static void mergeFills();
+        static bool isBlocked(int from, int to, Rect rc);
+        static bool isClipped(Op *op){ return !op->clip.include(op->rc); }
+        static void clipFill(Op *op);
+        static void buildStrips();
+        static void render(Surface *surface, Op *op);
+        static void renderStrip(Op *op);
+        static void execute(Op *op);
+        static void flush();
+
+    public:
+        static void begin();
+        static void end();
+#ifdef SHADOW_FRAME
+        static bool isRecording(){ return m_depth > 0; }   // シャドウフレームには必ずリストを通して描く
+#else
+        static bool isRecording(){ return m_enabled && (m_depth > 0); }
+#endif
+        static void setEnabled(bool enabled){ m_enabled = enabled; }
+        static void setStripEnabled(bool enabled){ m_stripEnabled = enabled; }
+        static void fillRect(HX8357 *display, Rect rc, uint16_t color);
+        static void drawText(HX8357 *display, Font *font, int16_t x, int16_t y, const char *text, uint16_t fgcol, uint16_t bkcol);
+        static void drawRun(HX8357 *display, Font *font, int16_t x, int16_t y, int16_t width, const GlyphRun *run, uint16_t first, uint16_t last, uint16_t fgcol, uint16_t bkcol);
+        static void drawIcon(HX8357 *display, int16_t x, int16_t y, Icon *icon, uint16_t fgcol, uint16_t bkcol);
+        static void drawBitmap(HX8357 *display, int16_t x, int16_t y, int16_t w, int16_t h, const uint16_t *image);
+        static void drawImage(HX8357 *display, int16_t x, int16_t y, RunLengthImage *image);
+};
+
 // -----------------------------------------------------------------------------
 class Graphics
 {
@@ -59,6 +183,9 @@ class Graphics
         uint16_t     m_strokeColor;
         uint16_t     m_fontColor;
         static Font *m_font[2];
+        enum{MAX_CLIP_DEPTH = 8};
+        static Rect  m_clipStack[MAX_CLIP_DEPTH];  // クリップ範囲(画面座標)
+        static int   m_clipDepth;
 
         Point toScreenCoord(Point pt){
             pt.x += this->m_clipRect.left;
@@ -71,6 +198,11 @@ class Graphics
             return rc;
         }
 
+        void fillScreenRect(Rect rc, uint16_t color);
+        void drawString(Font *font, int16_t x, int16_t y, const char *text);
+        void drawScreenRun(Font *font, int16_t x, int16_t y, const GlyphRun *run, uint16_t first, uint16_t last, int16_t width);
+        Point alignText(Point pt, Font *font, int16_t width, uint8_t alignment);
+
     public:
         enum{
             SCREEN_HEIGHT = 320,
@@ -95,7 +227,12 @@ class Graphics
         Graphics(HX8357 *display, Rect rc);
         void beginPaint();
         void endPaint();
+        void pushClip(Rect rc);
+        void popClip();
+        static Rect getClip();
         void setFont(int index){ this->m_fontIndex = index; }
+        Font *getFont(){ return Graphics::m_font[this->m_fontIndex]; }
+        int16_t getTextWidth(const char *text){ return this->getFont()->getTextWidth(text); }
         void setFillColor(uint16_t color){ this->m_fillColor = color; }
         void setStrokeColor(uint16_t color){ this->m_strokeColor = color; }
         void setFontColor(uint16_t color){ this->m_fontColor = color; }
@@ -109,9 +246,15 @@ class Graphics
         // void drawLine(int16_t x1, int16_t y1, int16_t x2, int16_t y2);
         void drawText(int16_t x, int16_t y, const char *text, uint8_t alignment=ALIGN_LEFT|ALIGN_TOP);
         void drawText(Rect rc, const char *text, uint8_t alignment=ALIGN_CENTER|ALIGN_MIDDLE);
+        void drawText(int16_t x, int16_t y, const GlyphRun *run, uint8_t alignment=ALIGN_LEFT|ALIGN_TOP);
+        void drawText(Rect rc, const GlyphRun *run, uint8_t alignment=ALIGN_CENTER|ALIGN_MIDDLE);
+        void drawRun(int16_t x, int16_t y, const GlyphRun *run, uint16_t first, uint16_t last);
+        Point alignText(Rect rc, Font *font, int16_t width, uint8_t alignment);
+        void shapeText(const char *text, GlyphRun *run);
         void drawIcon(int16_t x, int16_t y, Icon *icon, uint16_t fgcol, uint16_t bkcol);
         void drawBitmap(int16_t x, int16_t y, Bitmap *bitmap);
         void drawBitmap(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t *image);
+        void drawImage(int16_t x, int16_t y, RunLengthImage *image);
 
         static uint16_t RGBToColor(uint8_t r, uint8_t g, uint8_t b){
 		    return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3);
@@ -135,6 +278,10 @@ class UIWidget
         virtual void onTouched(int16_t x, int16_t y);
         virtual void onReleased();
         virtual void draw(Graphics *g);
+        virtual void addDirtyRect(Rect rc);
+#ifdef HX8357_STATS
+        static uint32_t m_drawCount;    // draw() を呼んだ回数(refresh() と paint())
+#endif
 
     public:
         UIWidget(uint16_t id, UIWidget *parent, HX8357 *display, int16_t left, int16_t top, uint16_t width, uint16_t height);
@@ -150,8 +297,36 @@ class UIWidget
         virtual void show();
         virtual void hide();
         virtual void refresh();
+        virtual void paint(Rect rc);
+        virtual void present(){}
+        void invalidate();
+        void invalidate(Rect rc);
 
         bool isVisible();
+#ifdef HX8357_STATS
+        static uint32_t getDrawCount(){ return m_drawCount; }
+        static void resetDrawCount(){ m_drawCount = 0; }
+#endif
+};
+
+// -----------------------------------------------------------------------------
+//  描画の予約
+//  request() した部品の present() を、パネルの走査と重ならないタイミング
+//  (TE 直後)にまとめて呼び出す
+// -----------------------------------------------------------------------------
+class PresentScheduler
+{
+    private:
+        enum{MAX_PENDING = 8};
+        enum{MAX_DELAY = 2*HX8357::FRAME_PERIOD};  // これ以上待たされたら TE を待たずに描画する(us)
+        static UIWidget *m_pending[MAX_PENDING];
+        static int       m_numPending;
+        static uint32_t  m_requestTime;
+
+    public:
+        static void request(UIWidget *widget);
+        static void execute();
+        static void flush();
 };
 
 
@@ -160,9 +335,14 @@ class UIWidget
 class Label : public UIWidget
 {
     private:
-        char   *m_text;
-        int16_t m_padding;
-        uint8_t m_alignment;
+        char    *m_text;
+        GlyphRun m_run;         // m_text をグリフに分解したもの
+        GlyphRun m_drawn;       // 画面に描画されている文字列
+        Point    m_drawnPos;    // その位置(クライアント座標)
+        bool     m_drawnValid;  // m_drawn と画面の内容が一致している
+        int16_t  m_padding;
+        uint8_t  m_alignment;
+        void setDrawn(Point pt);
     protected:
         void draw(Graphics *g);
     public:
@@ -174,6 +354,8 @@ class Label : public UIWidget
         void setBackColor(uint16_t color);
         void setFont(int index);
         void setText(const char *text);          
+        void setText(const char *text, const GlyphRun *run);
+        void present();
         const char *getText(){ return this->m_text; }
 };
 
@@ -307,6 +489,8 @@ class SevenSegLabel : public UIWidget
         void setFormat(FORMAT_PROC proc){ this->m_formatProc = proc; }
         void setValue(uint16_t value);
         void refresh();
+        void paint(Rect rc);
+        void present();
 };
 
 // -----------------------------------------------------------------------------
@@ -332,14 +516,21 @@ class SpectrumView : public UIWidget
     private:
         static const float SCALE;
         enum{NUM_BANDS = 16};
-        int16_t m_spectrum[NUM_BANDS];
+        enum{DEFAULT_FRAME_RATE = 30};
+        int16_t  m_spectrum[NUM_BANDS];
+        uint32_t m_interval;        // 描画間隔の下限(ms)
+        uint32_t m_lastPresent;
         void internalDraw(Graphics *g);
+        void requestPresent();
     protected:
         void draw(Graphics *g);
     public:
         SpectrumView(uint16_t id, UIWidget *parent, HX8357 *display, int16_t left, int16_t top);
         void update(AudioAnalyzeFFT1024 *fft);
         void clear();
+        void present();
+        // 描画頻度の上限(fps)を設定する(0 なら上限なし、update() のたびに描画する)
+        void setMaxFrameRate(uint16_t fps){ this->m_interval = (fps > 0)? 1000 / fps : 0; }
 };
 
 //------------------------------------------------------------------------------
@@ -363,18 +554,29 @@ class ProgressBar : public UIWidget
 };
 
 // -----------------------------------------------------------------------------
+//  invalidate() された範囲を重なるものどうしまとめて覚えておき、
+//  update() でまとめて描画する
 class Desktop : public UIWidget
 {
     private:
+        enum{MAX_DIRTY_RECTS = 8};
         ProgressBar *m_progressbar;
         Label       *m_label;
+        RunLengthImage *m_logo;
+        Rect         m_dirty[MAX_DIRTY_RECTS];  // 再描画が必要な範囲(画面座標)
+        int          m_numDirty;
     protected:
         void draw(Graphics *g);
+        void addDirtyRect(Rect rc);
     public:
         Desktop(HX8357 *display);
+        void update();
         void showProgress(int maximum, const char *message);
         void updateProgress(int value);
         void hideProgress();
+#ifdef HX8357_STATS
+        void measureImages(HX8357 *display);
+#endif
 };
 
 //------------------------------------------------------------------------------
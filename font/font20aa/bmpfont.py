@@ -16,7 +16,25 @@ def collect_chars():
     ucs2_codes.sort()
     return ucs2_codes
 
-def create_glyph(code, source_size, target_size):
+def pack_alpha(pixels, bits):
+    """
+    8bit のアルファ値を bits(4 または 2)ビットに量子化し、先頭のピクセルを
+    上位ビットに置いて詰める(グリフの末尾はバイト境界までゼロで埋める)
+    """
+    levels = (1 << bits) - 1
+    per_byte = 8 // bits
+    data = []
+    for i in range(0, len(pixels), per_byte):
+        value = 0
+        for j in range(per_byte):
+            q = 0
+            if i+j < len(pixels):
+                q = (pixels[i+j] * levels + 127) // 255
+            value |= q << (8 - bits*(j+1))
+        data.append(value)
+    return data
+
+def create_glyph(code, source_size, target_size, bits=8):
     font = ImageFont.truetype('rounded-mgenplus-1cp-medium.ttf', source_size*8)
     text = chr(code)
 
@@ -61,8 +79,9 @@ def create_glyph(code, source_size, target_size):
             pixels[y][x] = int(pixels[y][x] * r + 0.5)
             if pixels[y][x] > 0xFF:
                 pixels[y][x] = 0xFF
-        values = ','.join(['0x{:02X}'.format(p) for p in pixels[y]])
-        print('    {},'.format(values))
+        if bits == 8:
+            values = ','.join(['0x{:02X}'.format(p) for p in pixels[y]])
+            print('    {},'.format(values))
 
     # for y in range(height):
     #     values = []
@@ -75,38 +94,101 @@ def create_glyph(code, source_size, target_size):
 
     if height < target_size:
         while height < target_size:
-            values = ','.join(['0x00' for p in range(width)])
-            print('    {},  // <= brank line added'.format(values))
+            if bits == 8:
+                values = ','.join(['0x00' for p in range(width)])
+                print('    {},  // <= brank line added'.format(values))
+            pixels.append([0 for p in range(width)])
             height += 1
-    
+
+    if bits != 8:
+        data = pack_alpha([p for line in pixels for p in line], bits)
+        for i in range(0, len(data), 16):
+            values = ','.join(['0x{:02X}'.format(p) for p in data[i:i+16]])
+            print('    {},'.format(values))
+        print('')
+        return 1+len(data)
+
     print('')
     return 1+width*height
 
+FONTMAP_MAGIC = 0x50414D46  # 'FMAP'
+NOT_USED = 0xFFFFFFFF
+
+def build_pages(maps):
+    """
+    文字コード -> オフセットの表を２段の表に変換する
+        [0]         FONTMAP_MAGIC
+        [1..256]    上位バイトごとのページ位置(配列の先頭からの位置、未使用なら 0xFFFFFFFF)
+        ページ      先頭の語 = 最初の下位バイト | (最後の下位バイト << 8)
+                    続いて最初～最後の下位バイトのオフセット
+    """
+    pages = []
+    for hi in range(256):
+        codes = [lo for lo in range(256) if maps[hi*256+lo] != NOT_USED]
+        if len(codes) == 0:
+            pages.append(None)
+        else:
+            pages.append((codes[0], codes[-1]))
+    return pages
+
+def map_size(maps):
+    size = 1 + 256
+    for page in build_pages(maps):
+        if page is not None:
+            size += 1 + page[1] - page[0] + 1
+    return size
+
+def print_map(maps, target_size):
+    pages = build_pages(maps)
+    print('const uint32_t FONTMAP_{}AA[] PROGMEM = {{'.format(target_size))
+    print('    0x{0:08X}, // magic'.format(FONTMAP_MAGIC))
+    index = 1 + 256
+    for hi, page in enumerate(pages):
+        if page is None:
+            print('    0x{0:08X}, // U+{1:02X}xx (not used)'.format(NOT_USED, hi))
+        else:
+            print('    0x{0:08X}, // U+{1:02X}xx'.format(index, hi))
+            index += 1 + page[1] - page[0] + 1
+    for hi, page in enumerate(pages):
+        if page is None:
+            continue
+        first, last = page
+        print('    0x{0:08X}, // U+{1:02X}{2:02X}-U+{1:02X}{3:02X}'.format(first | (last << 8), hi, first, last))
+        for lo in range(first, last+1):
+            code = hi*256 + lo
+            addr = maps[code]
+            if addr != NOT_USED:
+                name = 'U+{:04X}'.format(code)
+            else:
+                name = 'U+{:04X} (not used)'.format(code)
+            print('    0x{0:08X}, // {1}'.format(addr, name))
+    print('};')
+
 if __name__ == '__main__':
     source_size = int(sys.argv[1])
     target_size = int(sys.argv[2])
+    bits = int(sys.argv[3]) if len(sys.argv) > 3 else 8     # アルファ値のビット数(8, 4, 2)
+    if bits not in (8, 4, 2):
+        print('ERROR: bits must be 8, 4 or 2', file=sys.stderr)
+        sys.exit(1)
     print('source size : {}'.format(source_size), file=sys.stderr)
     print('target size : {}'.format(target_size), file=sys.stderr)
+    print('alpha bits  : {}'.format(bits), file=sys.stderr)
 
     chars = collect_chars()
     print('{} characters'.format(len(chars)), file=sys.stderr)
     maps = [0xFFFFFFFF for i in range(65536)]
     offset = 0
+    print('#define FONT_{}AA_BITS {}'.format(target_size, bits))
+    print('')
     print('const uint8_t FONT_{}AA[] PROGMEM = {{'.format(target_size))
     for c in chars:
-        size = create_glyph(c, source_size, target_size)
+        size = create_glyph(c, source_size, target_size, bits)
         if size > 0:
             maps[c] = offset
             offset += size
     print('};')
     print('')
-    print('const uint32_t FONTMAP_{}AA[] PROGMEM = {{'.format(target_size))
-    for code, addr in enumerate(maps):
-        if addr != 0xFFFFFFFF:
-            name = 'U+{:04X}'.format(code)
-        else:
-            name = 'U+{:04X} (not used)'.format(code)
-        print('    0x{0:08X}, // {1}'.format(addr, name))
-    print('};')
+    print_map(maps, target_size)
 
-    print('total: {} bytes'.format(offset+65536*4), file=sys.stderr)
+    print('total: {} bytes'.format(offset+map_size(maps)*4), file=sys.stderr)
@@ -0,0 +1,103 @@
+import re
+import struct
+import sys
+
+#
+#   bmpfont.py が出力したヘッダファイルを、実行時に読み込むフォントファイルに変換する
+#       python font2bin.py <ヘッダファイル> <出力するファイル>
+#   出力したファイルは SD カードの /fonts に置く(arduino/view.cpp の FONT_FROM_SD を参照)
+#
+#   ファイルの形式(リトルエンディアン)
+#       0   'FNT1'
+#       4   文字高さ(1byte), アルファ値のビット数(1byte), 予備(2byte)
+#       8   マップデータの語数
+#       12  グリフデータのバイト数
+#       16  １文字のグリフデータの最大バイト数(幅の 1byte を含む)
+#       20  マップデータ(２段の表、bmpfont.py の print_map と同じ)、続いてグリフデータ
+#
+
+FONTMAP_MAGIC = 0x50414D46  # 'FMAP'
+NOT_USED = 0xFFFFFFFF
+
+def parse_array(text, name):
+    """
+    C の配列 name の要素を数値のリストとして返す
+    """
+    m = re.search(r'\b' + name + r'\s*\[\s*\]', text)
+    if m is None:
+        return None
+    body = text[m.end():]
+    body = body[body.index('{')+1:]
+    if '};' in body:
+        body = body[:body.index('};')]
+    body = re.sub(r'//[^\n]*', '', body)
+    return [int(v, 0) for v in re.findall(r'0[xX][0-9A-Fa-f]+|\d+', body)]
+
+def to_pages(flat):
+    """
+    65536 語の平坦な表を２段の表に変換する
+    """
+    pages = []
+    for hi in range(256):
+        codes = [lo for lo in range(256) if flat[hi*256+lo] != NOT_USED]
+        pages.append((codes[0], codes[-1]) if codes else None)
+    words = [FONTMAP_MAGIC]
+    index = 1 + 256
+    for page in pages:
+        if page is None:
+            words.append(NOT_USED)
+        else:
+            words.append(index)
+            index += 1 + page[1] - page[0] + 1
+    for hi, page in enumerate(pages):
+        if page is None:
+            continue
+        first, last = page
+        words.append(first | (last << 8))
+        words.extend(flat[hi*256+first:hi*256+last+1])
+    return words
+
+def offsets_of(words):
+    """
+    ２段の表に含まれるグリフのオフセットをすべて返す
+    """
+    offsets = []
+    for hi in range(256):
+        page = words[1+hi]
+        if page == NOT_USED:
+            continue
+        first = words[page] & 0xFF
+        last = (words[page] >> 8) & 0xFF
+        offsets.extend([v for v in words[page+1:page+1+last-first+1] if v != NOT_USED])
+    return offsets
+
+if __name__ == '__main__':
+    with open(sys.argv[1], mode='r') as fp:
+        text = fp.read()
+    m = re.search(r'\bFONT_(\d+)AA\s*\[', text)
+    if m is None:
+        print('ERROR: FONT_nnAA not found', file=sys.stderr)
+        sys.exit(1)
+    height = int(m[1])
+    m = re.search(r'#define\s+FONT_\d+AA_BITS\s+(\d+)', text)
+    bits = int(m[1]) if m else 8
+
+    data = parse_array(text, 'FONT_{}AA'.format(height))
+    words = parse_array(text, 'FONTMAP_{}AA'.format(height))
+    if words[0] != FONTMAP_MAGIC:
+        words = to_pages(words)
+
+    max_bytes = 0
+    for offset in offsets_of(words):
+        width = data[offset]
+        max_bytes = max(max_bytes, 1 + (width * height * bits + 7) // 8)
+
+    with open(sys.argv[2], mode='wb') as fp:
+        fp.write(b'FNT1')
+        fp.write(struct.pack('<BBH', height, bits, 0))
+        fp.write(struct.pack('<III', len(words), len(data), max_bytes))
+        fp.write(struct.pack('<{}I'.format(len(words)), *words))
+        fp.write(bytes(data))
+
+    print('height {}, {}bit, {} glyphs'.format(height, bits, len(offsets_of(words))))
+    print('map {} bytes, glyph {} bytes, max {} bytes/glyph'.format(len(words)*4, len(data), max_bytes))
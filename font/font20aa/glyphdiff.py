@@ -0,0 +1,94 @@
+from PIL import Image
+import re
+import sys
+
+#
+#   bmpfont.py が出力した 8bit のフォントデータと、4bit/2bit に詰めたフォントデータを
+#   比較する
+#       python glyphdiff.py <8bit のヘッダ> <比較するヘッダ> <文字高さ> <出力する PNG>
+#   出力する画像は１文字ごとに 8bit, 比較対象, 差分(４倍に強調) を横に並べたもの
+#
+
+def load_glyphs(path):
+    """
+    ヘッダファイルを読み込み、{文字コード: (幅, データ)} と アルファ値のビット数 を返す
+    """
+    with open(path, mode='r') as fp:
+        text = fp.read()
+    m = re.search(r'#define\s+FONT_\d+AA_BITS\s+(\d+)', text)
+    bits = int(m[1]) if m else 8
+    body = text[text.index('FONT_'):]
+    body = body[body.index('{')+1:]
+    if '};' in body:
+        body = body[:body.index('};')]
+
+    glyphs = {}
+    code = None
+    for line in body.split('\n'):
+        m = re.match(r'^\s*(\d+),\s*//\s*U\+([0-9A-F]{4})', line)
+        if m:
+            code = int(m[2], 16)
+            glyphs[code] = (int(m[1]), [])
+            continue
+        if code is not None:
+            line = line.split('//')[0]
+            glyphs[code][1].extend([int(v, 16) for v in re.findall(r'0x([0-9A-Fa-f]{2})', line)])
+    return glyphs, bits
+
+def unpack_alpha(data, bits, count):
+    """
+    詰められたアルファ値を 8bit に戻す(Font::drawChar と同じ展開)
+    """
+    if bits == 8:
+        return data[:count]
+    levels = (1 << bits) - 1
+    per_byte = 8 // bits
+    pixels = []
+    for value in data:
+        for j in range(per_byte):
+            q = (value >> (8 - bits*(j+1))) & levels
+            pixels.append(q * 255 // levels)
+    return pixels[:count]
+
+if __name__ == '__main__':
+    ref_glyphs, ref_bits = load_glyphs(sys.argv[1])
+    cmp_glyphs, cmp_bits = load_glyphs(sys.argv[2])
+    height = int(sys.argv[3])
+    output = sys.argv[4]
+
+    codes = sorted(set(ref_glyphs.keys()) & set(cmp_glyphs.keys()))
+    cell = max([ref_glyphs[c][0] for c in codes]) * 3 + 4
+    columns = 16
+    rows = (len(codes) + columns - 1) // columns
+    image = Image.new('L', (cell * columns, (height + 2) * rows), 0x40)
+
+    total_error = 0
+    total_pixels = 0
+    worst = (0, 0)
+    for n, code in enumerate(codes):
+        width = ref_glyphs[code][0]
+        if cmp_glyphs[code][0] != width:
+            print('U+{:04X}: width differs ({} / {})'.format(code, width, cmp_glyphs[code][0]), file=sys.stderr)
+            continue
+        ref = unpack_alpha(ref_glyphs[code][1], ref_bits, width*height)
+        cmp = unpack_alpha(cmp_glyphs[code][1], cmp_bits, width*height)
+        x0 = (n % columns) * cell
+        y0 = (n // columns) * (height + 2)
+        error = 0
+        for i in range(width*height):
+            x = i % width
+            y = i // width
+            d = abs(ref[i] - cmp[i])
+            error = max(error, d)
+            total_error += d
+            image.putpixel((x0 + x, y0 + y), ref[i])
+            image.putpixel((x0 + width + 1 + x, y0 + y), cmp[i])
+            image.putpixel((x0 + 2*(width + 1) + x, y0 + y), min(d * 4, 255))
+        total_pixels += width*height
+        if error > worst[1]:
+            worst = (code, error)
+
+    image.save(output)
+    print('{} glyphs, {}bit vs {}bit'.format(len(codes), ref_bits, cmp_bits))
+    print('mean error : {:.2f}'.format(total_error / max(total_pixels, 1)))
+    print('max error  : {} (U+{:04X})'.format(worst[1], worst[0]))
@@ -1,19 +1,17 @@
 import os
 from PIL import Image
+import rle
 
 img = Image.open('digits.png')
 img = img.convert('RGBA')
 r, g, b, a = img.split()
 
-print('const uint8_t DIGITS[] PROGMEM = {')
-
+# 11 文字(0～9 と空白)をランレングス圧縮して１つの配列に並べる(形式は rle.py を参照)
+# 各文字の位置は SSEG_DIGITS_OFFSET に出力する
+text = 'const uint8_t SSEG_DIGITS[] PROGMEM = {\n'
 for n in range(11):
-    print('    20, 30')
     x = n*20
-    for y in range(30):
-        values = []
-        for i in range(20):
-            values.append('{: >3}'.format(a.getpixel((x+i, y))))
-        print('    {},'.format(','.join(values)))
-    print('')
-print('};')
+    values = [a.getpixel((x+i, y)) for y in range(30) for i in range(20)]
+    text += '    20, 30,\n    {},\n'.format(','.join([str(v) for v in values]))
+text += '};\n'
+rle.convert_header(text)
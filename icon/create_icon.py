@@ -2,22 +2,16 @@ import sys
 import os
 
 from PIL import Image
+import rle
 
 def dump_image(path, name):
     img = Image.open(path)
     img = img.convert('RGBA')
     r, g, b, a = img.split()
     # name = os.path.splitext(os.path.basename(path).upper())[0]
-    print('const uint8_t {}[] PROGMEM = {{'.format(name))
-    print('    {0: >3}, // width ({0}px)'.format(a.size[0]))
-    print('    {0: >3}, // height({0}px)'.format(a.size[1]))
-    for y in range(a.size[1]):
-        values = []
-        for x in range(a.size[0]):
-            values.append('{: >3}'.format(a.getpixel((x, y))))
-        print('    {},'.format(','.join(values)))
-    print('};')
-    print('')
+    values = [a.getpixel((x, y)) for y in range(a.size[1]) for x in range(a.size[0])]
+    # ランレングス圧縮して出力する(形式は rle.py を参照)
+    rle.print_icon(name, a.size[0], a.size[1], values)
 
 if __name__ == '__main__':
     images = [
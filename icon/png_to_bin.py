@@ -1,6 +1,7 @@
 import struct
 import sys
 from PIL import Image
+import rle
 
 def write_word(fp, value):
     fp.write(struct.pack('<H', value))
@@ -12,20 +13,18 @@ def png_to_bin(src_path, dst_path):
     img = Image.open(src_path)
     img = img.convert('RGB')
     w, h = img.size
-    print('const uint16_t LOGO[] PROGMEM = {')
-    print('    0x{0:04X},0x{1:04X},    // width = {0}, height = {1}'.format(w, h))
+    pixels = []
     with open(dst_path, mode='wb') as fp:
         write_word(fp, w)
         write_word(fp, h)
         for y in range(h):
-            data = []
             for x in range(w):
                 r, g, b = img.getpixel((x, y))
                 v = color_565(r, g, b)
                 write_word(fp, v)
-                data.append(v)
-            print('    ' + ','.join(['0x{:04X}'.format(v) for v in data]) + ',')                     
-        print('};')
+                pixels.append(v)
+    # ヘッダはランレングス圧縮して出力する(形式は rle.py を参照)
+    rle.print_image('LOGO', w, h, pixels)
 
 if __name__ == '__main__':
     png_to_bin(sys.argv[1], sys.argv[2])
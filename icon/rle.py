@@ -0,0 +1,197 @@
+import re
+import sys
+
+#
+#   アイコン(8bit アルファ値)とロゴ(RGB565)のランレングス圧縮
+#   create_icon.py, create_digit.py, png_to_bin.py から使う
+#
+#   アイコンの形式(arduino/display.cpp の Icon を参照)
+#       0, 幅, 高さ, 続いて次の命令の並び(行をまたいで続く)
+#       0x00-0x7F : 透明(アルファ値 0)が (n & 0x7F)+1 ピクセル
+#       0x80-0xBF : 不透明(アルファ値 255)が (n & 0x3F)+1 ピクセル
+#       0xC0-0xFF : 続く (n & 0x3F)+1 バイトがそのままのアルファ値(縁のピクセル)
+#
+#   ロゴの形式(arduino/display.cpp の RunLengthImage を参照)
+#       幅, 高さ, 続いて次の命令の並び(16bit 単位)
+#       0x8000 | n : 続く１語の色が n ピクセル
+#       n          : 続く n 語がそのままの色
+#
+#   既に出力したヘッダファイルを変換することもできる
+#       python rle.py <ヘッダファイル>  (標準出力に書き出す)
+#
+
+ALPHA_RUN_MAX = 128
+OPAQUE_RUN_MAX = 64
+LITERAL_MAX = 64
+
+def alpha_length(data):
+    """
+    圧縮したアルファ値の命令列が表すピクセル数を返す
+    """
+    count = 0
+    i = 0
+    while i < len(data):
+        tag = data[i]
+        i += 1
+        if tag < 0x80:
+            count += tag + 1
+        else:
+            n = (tag & 0x3F) + 1
+            if tag >= 0xC0:
+                assert i + n <= len(data), 'literal runs past the end of data'
+                i += n
+            count += n
+    return count
+
+def rgb565_length(data):
+    """
+    圧縮した RGB565 の命令列が表すピクセル数を返す
+    """
+    count = 0
+    i = 0
+    while i < len(data):
+        tag = data[i]
+        n = tag & 0x7FFF
+        i += 2 if tag & 0x8000 else 1 + n
+        assert i <= len(data), 'literal runs past the end of data'
+        count += n
+    return count
+
+def encode_alpha(values):
+    """
+    アルファ値の並びを圧縮したバイト列(先頭の 0, 幅, 高さは含まない)を返す
+    """
+    data = []
+    literal = []
+    def flush_literal():
+        while literal:
+            chunk = literal[:LITERAL_MAX]
+            del literal[:LITERAL_MAX]
+            data.append(0xC0 | (len(chunk) - 1))
+            data.extend(chunk)
+
+    i = 0
+    while i < len(values):
+        v = values[i]
+        limit = ALPHA_RUN_MAX if v == 0 else OPAQUE_RUN_MAX
+        n = 1
+        while (i + n < len(values)) and (values[i + n] == v) and (n < limit):
+            n += 1
+        # １ピクセルだけの透明・不透明は縁の続きとして扱う方が短い
+        if v in (0, 255) and (n >= 2 or not literal):
+            flush_literal()
+            data.append((n - 1) if v == 0 else (0x80 | (n - 1)))
+            i += n
+        else:
+            literal.append(v)
+            i += 1
+    flush_literal()
+    # Icon::drawStream() などは命令の長さを信じて展開するので、ちょうど w*h になること
+    assert alpha_length(data) == len(values), 'alpha runs do not add up to w*h'
+    return data
+
+def encode_rgb565(values):
+    """
+    RGB565 の並びを圧縮した語の列(先頭の幅, 高さは含まない)を返す
+    """
+    data = []
+    literal = []
+    def flush_literal():
+        while literal:
+            chunk = literal[:0x7FFF]
+            del literal[:0x7FFF]
+            data.append(len(chunk))
+            data.extend(chunk)
+
+    i = 0
+    while i < len(values):
+        v = values[i]
+        n = 1
+        while (i + n < len(values)) and (values[i + n] == v) and (n < 0x7FFF):
+            n += 1
+        # ３ピクセル以上続けばランにする(命令と色の２語で済む)
+        if n >= 3:
+            flush_literal()
+            data.append(0x8000 | n)
+            data.append(v)
+            i += n
+        else:
+            literal.extend(values[i:i+n])
+            i += n
+    flush_literal()
+    assert rgb565_length(data) == len(values), 'rgb565 runs do not add up to w*h'
+    return data
+
+def print_icon(name, width, height, values, fp=sys.stdout):
+    """
+    アイコンを C の配列として書き出す
+    """
+    assert len(values) == width * height, '{}: {} pixels for {}x{}'.format(name, len(values), width, height)
+    data = encode_alpha(values)
+    print('const uint8_t {}[] PROGMEM = {{'.format(name), file=fp)
+    print('      0, // run-length', file=fp)
+    print('    {0: >3}, // width ({0}px)'.format(width), file=fp)
+    print('    {0: >3}, // height({0}px)'.format(height), file=fp)
+    for i in range(0, len(data), 24):
+        print('    {},'.format(','.join(['{: >3}'.format(v) for v in data[i:i+24]])), file=fp)
+    print('};', file=fp)
+    print('// {} bytes (raw {} bytes)'.format(3 + len(data), 2 + width * height), file=fp)
+    print('', file=fp)
+    return 3 + len(data)
+
+def print_image(name, width, height, values, fp=sys.stdout):
+    """
+    RGB565 の画像を C の配列として書き出す
+    """
+    assert len(values) == width * height, '{}: {} pixels for {}x{}'.format(name, len(values), width, height)
+    data = encode_rgb565(values)
+    print('const uint16_t {}[] PROGMEM = {{'.format(name), file=fp)
+    print('    0x{0:04X},0x{1:04X},    // width = {0}, height = {1}'.format(width, height), file=fp)
+    for i in range(0, len(data), 16):
+        print('    ' + ','.join(['0x{:04X}'.format(v) for v in data[i:i+16]]) + ',', file=fp)
+    print('};', file=fp)
+    print('// {} bytes (raw {} bytes)'.format(2 * (2 + len(data)), 2 * (2 + width * height)), file=fp)
+    print('', file=fp)
+    return 2 * (2 + len(data))
+
+def convert_header(text, fp=sys.stdout):
+    """
+    create_icon.py, create_digit.py, png_to_bin.py が出力した圧縮前のヘッダを変換する
+    SSEG_DIGITS のように１つの配列に複数の画像が並ぶ場合は、
+    配列名_OFFSET に各画像の位置を書き出す
+    """
+    for m in re.finditer(r'const\s+(uint8_t|uint16_t)\s+(\w+)\[\]\s*PROGMEM\s*=\s*\{(.*?)\};', text, re.S):
+        kind, name, body = m[1], m[2], m[3]
+        body = re.sub(r'//[^\n]*', '', body)
+        values = [int(v, 0) for v in re.findall(r'0[xX][0-9A-Fa-f]+|\d+', body)]
+        if kind == 'uint16_t':
+            width, height = values[0], values[1]
+            print_image(name, width, height, values[2:2+width*height], fp)
+            continue
+        offsets = []
+        data = []
+        i = 0
+        while i < len(values):
+            width, height = values[i], values[i+1]
+            pixels = values[i+2:i+2+width*height]
+            assert len(pixels) == width * height, '{}[{}]: truncated image'.format(name, len(offsets))
+            offsets.append(len(data))
+            data.extend([0, width, height] + encode_alpha(pixels))
+            i += 2 + width * height
+        if len(offsets) == 1:
+            print_icon(name, width, height, pixels, fp)
+            continue
+        print('const uint8_t {}[] PROGMEM = {{'.format(name), file=fp)
+        for n, offset in enumerate(offsets):
+            end = offsets[n+1] if n + 1 < len(offsets) else len(data)
+            print('    // [{}]'.format(n), file=fp)
+            for j in range(offset, end, 24):
+                print('    {},'.format(','.join(['{: >3}'.format(v) for v in data[j:min(j+24, end)]])), file=fp)
+        print('};', file=fp)
+        print('const uint16_t {}_OFFSET[] = {{{}}};'.format(name, ', '.join([str(v) for v in offsets])), file=fp)
+        print('// {} bytes (raw {} bytes)'.format(len(data), len(values)), file=fp)
+        print('', file=fp)
+
+if __name__ == '__main__':
+    with open(sys.argv[1], mode='r') as fp:
+        convert_header(fp.read())
@@ -3,6 +3,7 @@ import os
 import glob
 import json
 import struct
+import zlib
 import collections
 import contextlib
 import mutagen
@@ -35,6 +36,92 @@ def read_string(fp):
     n = read_byte(fp)
     return fp.read(n).decode('utf-8')
 
+#
+#   分解済みグリフ(オプション)
+#       python create_playdata.py <root> [<17px の .fnt> <20px の .fnt>]
+#   フォントファイル(font/font20aa/font2bin.py で作成)を指定すると、playdata.bin と
+#   album.bin の先頭バイトの最上位ビットを立て、曲名・アルバム名・アーティスト名の後に
+#   次のデータを書き込む。本体はこれを読み込み、描画時の UTF-8 の解析と幅の計算を省く
+#       文字数(1byte), 文字コード(2byte × 文字数)
+#       フォントごとに 全体の幅(2byte), オフセット(4byte × 文字数), 各文字の幅(1byte × 文字数)
+#   また、先頭バイトの直後にフォントごとのシグネチャ(4byte × 2)を書き込む
+#       CRC-32(文字高さ(1byte), ビット数(1byte), グリフデータのバイト数(4byte), マップデータ)
+#   本体は組み込んだフォントのシグネチャと照合し、違っていれば分解済みのデータを使わない
+#
+GLYPHS_FLAG = 0x80
+FONTMAP_MAGIC = 0x50414D46  # 'FMAP'
+NOT_USED = 0xFFFFFFFF
+glyph_fonts = []
+
+class GlyphFont:
+    def __init__(self, path):
+        with open(path, mode='rb') as fp:
+            data = fp.read()
+        if data[0:4] != b'FNT1':
+            raise Exception('Invalid font file -- {}'.format(path))
+        map_words, data_bytes, _ = struct.unpack('<III', data[8:20])
+        self.__map = struct.unpack('<{}I'.format(map_words), data[20:20+map_words*4])
+        self.__data = data[20+map_words*4:]
+        if self.__map[0] != FONTMAP_MAGIC:
+            raise Exception('Unsupported font map -- {}'.format(path))
+        # 本体の Font::signatureHeader() と同じ計算
+        height, bits = data[4], data[5]
+        self.signature = zlib.crc32(bytes([height, bits]) + struct.pack('<I', data_bytes) + data[20:20+map_words*4])
+
+    def lookup(self, code):
+        """
+        文字コードから (オフセット, 幅) を得る(ない文字は (NOT_USED, 0))
+        """
+        page = self.__map[1 + (code >> 8)]
+        if page == NOT_USED:
+            return (NOT_USED, 0)
+        first = self.__map[page] & 0xFF
+        last = (self.__map[page] >> 8) & 0xFF
+        lo = code & 0xFF
+        if lo < first or last < lo:
+            return (NOT_USED, 0)
+        offset = self.__map[page + 1 + lo - first]
+        if offset == NOT_USED:
+            return (NOT_USED, 0)
+        return (offset, self.__data[offset])
+
+def char_codes(s):
+    """
+    本体(Font::getCharCodeAt)と同じ規則で文字列を文字コードの並びにする
+    """
+    codes = []
+    for c in s:
+        code = ord(c)
+        if code > 0xFFFF or (code < 0x80 and not (0x20 <= code <= 0x7E)):
+            continue
+        if code == 0xFF5E:
+            code = 0x301C
+        codes.append(code)
+    return codes
+
+def write_signatures(fp):
+    for font in glyph_fonts:
+        fp.write(struct.pack('<I', font.signature))
+
+def write_glyphs(fp, s):
+    if not glyph_fonts:
+        return
+    codes = []
+    for code in char_codes(s):
+        if any([font.lookup(code)[0] != NOT_USED for font in glyph_fonts]):
+            codes.append(code)
+    codes = codes[:255]
+    write_byte(fp, len(codes))
+    for code in codes:
+        write_word(fp, code)
+    for font in glyph_fonts:
+        glyphs = [font.lookup(code) for code in codes]
+        write_word(fp, sum([g[1] for g in glyphs]))
+        for g in glyphs:
+            fp.write(struct.pack('<I', g[0]))
+        for g in glyphs:
+            write_byte(fp, g[1])
+
 def convert_code(s):
     if chr(0xFF5E) in s:
         print('  WARNING: U+FF5E found -- 「{}」'.format(s))
@@ -44,6 +131,67 @@ def convert_code(s):
 def color_565(r, g, b):
     return ((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3)
 
+#
+#   アルバム画像の圧縮(QOI 形式を RGB565 向けにしたもの、RGB565 としては可逆)
+#   album.bin の先頭バイトの COVER_COMPRESSED のビットを立て、画像の代わりに
+#   圧縮後のバイト数(4byte)と次の命令の並びを書き込む(arduino/display.cpp の Bitmap::loadCompressed を参照)
+#       0x00-0x3F : 色の表(64 色)の n 番目の色
+#       0x40-0x7F : 直前の色から R, G, B をそれぞれ -2〜+1 変える(2bit ずつ、+2 した値)
+#       0x80-0xBF : 直前の色から G を (n & 0x3F)-32 変え、続く１バイトの上位4bit-8 + G の差/2 を R に、
+#                   下位4bit-8 + G の差/2 を B に加える
+#       0xC0-0xFD : 直前の色が (n & 0x3F)+1 ピクセル続く
+#       0xFE      : 続く２バイトがそのままの色(リトルエンディアン)
+#   色の表は (R*3 + G*5 + B*7) % 64 の位置に、展開したピクセルの色を順に覚えておく
+#   R, B は 5bit, G は 6bit の値で、差はそれぞれのビット数で折り返す
+#
+COVER_COMPRESSED = 0x40
+COVER_RUN_MAX = 62
+
+def cover_hash(c):
+    return ((c >> 11) * 3 + ((c >> 5) & 0x3F) * 5 + (c & 0x1F) * 7) % 64
+
+def wrap(value, bits):
+    half = 1 << (bits - 1)
+    return ((value + half) & ((1 << bits) - 1)) - half
+
+def encode_cover(pixels):
+    data = bytearray()
+    index = [0] * 64
+    prev = 0
+    run = 0
+    for c in pixels:
+        if c == prev:
+            run += 1
+            if run == COVER_RUN_MAX:
+                data.append(0xC0 | (run - 1))
+                run = 0
+            continue
+        if run:
+            data.append(0xC0 | (run - 1))
+            run = 0
+        h = cover_hash(c)
+        if index[h] == c:
+            data.append(h)
+        else:
+            index[h] = c
+            dr = wrap((c >> 11) - (prev >> 11), 5)
+            dg = wrap(((c >> 5) & 0x3F) - ((prev >> 5) & 0x3F), 6)
+            db = wrap((c & 0x1F) - (prev & 0x1F), 5)
+            half = dg >> 1
+            if -2 <= dr <= 1 and -2 <= dg <= 1 and -2 <= db <= 1:
+                data.append(0x40 | ((dr + 2) << 4) | ((dg + 2) << 2) | (db + 2))
+            elif -8 <= dr - half <= 7 and -8 <= db - half <= 7:
+                data.append(0x80 | (dg + 32))
+                data.append(((dr - half + 8) << 4) | (db - half + 8))
+            else:
+                data.append(0xFE)
+                data.append(c & 0xFF)
+                data.append(c >> 8)
+        prev = c
+    if run:
+        data.append(0xC0 | (run - 1))
+    return data
+
 class Song:
     def __init__(self, album):
         self.__album = album
@@ -101,6 +249,7 @@ class Song:
         write_word(fp, self.__bitrate)      # kbps 単位 (ex. 320)
         write_word(fp, self.__sample_rate)  # 100Hz 単位 (ex. 441)
         write_string(fp, self.__title)
+        write_glyphs(fp, self.__title)
     
     def get_all_chars(self):
         return list(self.__title)
@@ -172,6 +321,7 @@ class Album:
         write_word(fp, self.__gid)
         write_string(fp, self.__folder_name)
         write_string(fp, self.__title)
+        write_glyphs(fp, self.__title)
         write_word(fp, self.__year)
         write_byte(fp, len(self.__songs))
         write_word(fp, sum([song.duration for song in self.__songs]))
@@ -180,7 +330,9 @@ class Album:
     def save_album_data(self):
         file_path = os.path.join(self.__artist.directory, self.__folder_name, 'album.bin')
         with open(file_path, mode='wb') as fp:
-            write_byte(fp, 1 if 'm4a' in self.__songs[0].filename.lower() else 0)
+            codec = 1 if 'm4a' in self.__songs[0].filename.lower() else 0
+            write_byte(fp, codec | COVER_COMPRESSED | (GLYPHS_FLAG if glyph_fonts else 0))
+            write_signatures(fp)
             write_byte(fp, len(self.__songs))
             for song in self.__songs:
                 song.write_binary(fp)
@@ -195,10 +347,15 @@ class Album:
         w, h = img.size
         # write_word(fp, w)
         # write_word(fp, h)
+        pixels = []
         for y in range(h):
             for x in range(w):
                 r, g, b = img.getpixel((x, y))
-                write_word(fp, color_565(r, g, b))                     
+                pixels.append(color_565(r, g, b))
+        data = encode_cover(pixels)
+        fp.write(struct.pack('<I', len(data)))
+        fp.write(data)
+        print('  cover image {} bytes (raw {} bytes)'.format(4 + len(data), 2 * w * h))
 
     def create_thumbnail(self, save_dir):
         img = self.__thumb_image.convert('RGB')
@@ -264,6 +421,7 @@ class Artist:
         write_word(fp, self.__gid)
         write_string(fp, self.folder_name)
         write_string(fp, self.__name)
+        write_glyphs(fp, self.__name)
         write_byte(fp, len(self.__albums))
         for album in self.__albums:
             album.write_binary(fp)
@@ -292,6 +450,9 @@ class Artist:
 
 if __name__ == '__main__':
     root_directory = sys.argv[1]
+    if len(sys.argv) > 3:
+        glyph_fonts = [GlyphFont(sys.argv[2]), GlyphFont(sys.argv[3])]
+        print('glyph data enabled -- {}, {}'.format(sys.argv[2], sys.argv[3]))
     search_path = os.path.join(root_directory, '*')
     artist_directories = [dir for dir in glob.glob(search_path) if os.path.isdir(dir)]
     artists = []
@@ -306,7 +467,8 @@ if __name__ == '__main__':
     artists.sort(key=lambda a: a.folder_name.lower())
     binary_path = os.path.join(root_directory, 'playdata.bin')
     with open(binary_path, mode='wb') as fp:
-        write_byte(fp, len(artists))
+        write_byte(fp, len(artists) | (GLYPHS_FLAG if glyph_fonts else 0))
+        write_signatures(fp)
         for artist in artists:
             artist.write_binary(fp)
             chars += artist.get_all_chars()